@@ -0,0 +1,281 @@
+/**
+ * @file BatchDecoder.h
+ * @brief Header with a description and implementation of the BatchDecoder class template
+ * (concurrent decoding of many PNG or BMP images)
+ * @version 0.1.0
+ * @date 2026-10-17
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+#ifndef BATCH_DECODER_H
+#define BATCH_DECODER_H
+
+#include "ImagePNG.h"
+#include "ImageBMP.h"
+#include <stddef.h>
+#include <string>
+#include <deque>
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+#define BATCH_DECODER_MEMORY_LIMIT    (512*1024*1024)
+
+/**
+ * @brief namespace of ImageEditor.h
+ * 
+ */
+namespace ie
+{
+
+/**
+ * @brief Class template for decoding a list of images on a pool of threads<br>
+ * (ImageType is ImagePNG or ImageBMP; the images are given out by next() in the order 
+ * they are decoded, the decoding errors end the program as in readImageFromFile)
+ * 
+ */
+template <class ImageType>
+class BatchDecoder
+{
+public:
+
+    /**
+     * @brief Construct a new BatchDecoder object and start the threads
+     * 
+     * @param[in] threads number of decoding threads (0 - one per core)
+     * @param[in] memory_limit the threads do not start new images while decoded images 
+     * not yet taken by next() use this many bytes of pixel data
+     */
+    explicit BatchDecoder(int threads = 0, size_t memory_limit = BATCH_DECODER_MEMORY_LIMIT);
+
+
+    /**
+     * @brief Destroy the BatchDecoder object<br>
+     * (images not yet started are skipped, the threads finish the current images)
+     * 
+     */
+    ~BatchDecoder();
+
+
+    BatchDecoder(const BatchDecoder&) = delete;
+    BatchDecoder& operator=(const BatchDecoder&) = delete;
+
+
+    /**
+     * @brief Add a file to decode
+     * 
+     * @param[in] file_name image file name
+     * @return size_t - index of the image (the number of images added before)
+     */
+    size_t addFile(const char *file_name);
+
+
+    /**
+     * @brief Add file data in memmory to decode<br>
+     * (the data is not copied and must stay valid until the image is given out by next())
+     * 
+     * @param[in] data image file data
+     * @param[in] size data size in bytes
+     * @return size_t - index of the image (the number of images added before)
+     */
+    size_t addMemory(const void *data, size_t size);
+
+
+    /**
+     * @brief Wait for the next decoded image
+     * 
+     * @param[out] image decoded image
+     * @param[out] index index of the image returned by addFile or addMemory (can be NULL)
+     * @return true - if an image is given out
+     * @return false - if all the added images are already given out
+     */
+    bool next(ImageType& image, size_t *index = NULL);
+
+
+private:
+
+    struct Job
+    {
+        std::string   file_name;
+        const void   *data;
+        size_t        size;
+        size_t        index;
+    };
+
+    std::mutex                                  mutex_;
+    std::condition_variable                     job_added_;
+    std::condition_variable                     image_decoded_;
+    std::deque<Job>                             jobs_;
+    std::deque<std::pair<size_t, ImageType>>    images_;
+    std::vector<std::thread>                    threads_;
+    size_t                                      memory_limit_;
+    size_t                                      decoded_bytes_;
+    size_t                                      added_count_;
+    size_t                                      given_count_;
+    bool                                        stop_;
+
+
+    /**
+     * @brief Size of the pixel data held by the image<br>
+     * (rows with padding, in the native pixel format of PNG images)
+     * 
+     * @param[in] image decoded image
+     * @return size_t - size in bytes
+     */
+    static size_t imageBytes(ImageType& image);
+
+
+    /**
+     * @brief Give the codec context of the thread to the image before decoding<br>
+     * (BMP images do not use it)
+     * 
+     * @param[in] image image to decode
+     * @param[in] context codec context of the thread (NULL - no context)
+     */
+    static void setCodecContext(ImagePNG& image, PNGCodecContext *context);
+    static void setCodecContext(ImageBMP& image, PNGCodecContext *context);
+
+
+    /**
+     * @brief Thread function: decode the added images while the decoder exists
+     * 
+     */
+    void work();
+};
+
+
+template <class ImageType>
+BatchDecoder<ImageType>::BatchDecoder(int threads, size_t memory_limit) :
+    memory_limit_(memory_limit),
+    decoded_bytes_(0),
+    added_count_(0),
+    given_count_(0),
+    stop_(false)
+{
+    if (threads <= 0) {
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    for (int i = 0; i < threads; i++) {
+        threads_.emplace_back(&BatchDecoder::work, this);
+    }
+}
+
+template <class ImageType>
+BatchDecoder<ImageType>::~BatchDecoder()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    job_added_.notify_all();
+    for (std::thread& thread : threads_) {
+        thread.join();
+    }
+}
+
+template <class ImageType>
+size_t BatchDecoder<ImageType>::addFile(const char *file_name)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    jobs_.push_back({file_name, NULL, 0, added_count_});
+    job_added_.notify_one();
+    return added_count_++;
+}
+
+template <class ImageType>
+size_t BatchDecoder<ImageType>::addMemory(const void *data, size_t size)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    jobs_.push_back({std::string(), data, size, added_count_});
+    job_added_.notify_one();
+    return added_count_++;
+}
+
+template <class ImageType>
+bool BatchDecoder<ImageType>::next(ImageType& image, size_t *index)
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    image_decoded_.wait(lock, [this]() { return !images_.empty() || given_count_ == added_count_; });
+    if (images_.empty()) {
+        return false;
+    }
+
+    if (index) {
+        *index = images_.front().first;
+    }
+    image = std::move(images_.front().second);
+    images_.pop_front();
+    decoded_bytes_ -= imageBytes(image);
+    given_count_++;
+
+    lock.unlock();
+    job_added_.notify_all();
+    return true;
+}
+
+template <class ImageType>
+size_t BatchDecoder<ImageType>::imageBytes(ImageType& image)
+{
+    return image.getDataSize();
+}
+
+template <class ImageType>
+void BatchDecoder<ImageType>::setCodecContext(ImagePNG& image, PNGCodecContext *context)
+{
+    image.setCodecContext(context);
+}
+
+template <class ImageType>
+void BatchDecoder<ImageType>::setCodecContext(ImageBMP& image, PNGCodecContext *context)
+{
+    (void) image;
+    (void) context;
+}
+
+template <class ImageType>
+void BatchDecoder<ImageType>::work()
+{
+    /* libpng memmory of one file is reused for the next files decoded by the thread */
+    PNGCodecContext codec_context;
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+        job_added_.wait(lock, [this]() { 
+            return stop_ || (!jobs_.empty() && decoded_bytes_ < memory_limit_); 
+        });
+        if (stop_) {
+            return;
+        }
+
+        Job job = std::move(jobs_.front());
+        jobs_.pop_front();
+        lock.unlock();
+
+        ImageType image;
+        setCodecContext(image, &codec_context);
+        if (job.data) {
+            image.readImageFromMemory(job.data, job.size);
+        } else {
+            image.readImageFromFile(job.file_name.c_str());
+        }
+        setCodecContext(image, NULL);
+        size_t bytes = imageBytes(image);
+
+        lock.lock();
+        decoded_bytes_ += bytes;
+        images_.emplace_back(job.index, std::move(image));
+        image_decoded_.notify_one();
+    }
+}
+
+
+extern template class BatchDecoder<ImagePNG>;
+extern template class BatchDecoder<ImageBMP>;
+
+}
+#endif
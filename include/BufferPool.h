@@ -0,0 +1,186 @@
+/**
+ * @file BufferPool.h
+ * @brief Header with a description of the BufferPool class (reuse of pixel data memmory)
+ * @version 0.1.0
+ * @date 2026-10-17
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+#ifndef BUFFER_POOL_H
+#define BUFFER_POOL_H
+
+#include <stddef.h>
+#include <map>
+#include <utility>
+#include <vector>
+#include <mutex>
+
+#define BUFFER_POOL_ALIGNMENT          64
+#define BUFFER_POOL_MIN_SIZE           4096
+#define BUFFER_POOL_HUGE_PAGE_SIZE     (2*1024*1024)
+#define BUFFER_POOL_DEFAULT_LIMIT      (256*1024*1024)
+
+/**
+ * @brief namespace of ImageEditor.h
+ * 
+ */
+namespace ie
+{
+
+
+/**
+ * @brief Structure for representing BufferPool statistics
+ * 
+ */
+struct BufferPoolStats
+{
+    size_t hits;              ///< acquisitions served by a cached block
+    size_t misses;            ///< acquisitions that allocated a new block
+    size_t in_use_bytes;      ///< bytes of blocks given out and not yet returned
+    size_t cached_bytes;      ///< bytes of free blocks kept for reuse
+    size_t resident_bytes;    ///< in_use_bytes + cached_bytes
+
+    /**
+     * @brief Get the part of acquisitions served from the cache
+     * 
+     * @return double - hit rate [0..1]
+     */
+    double hitRate() const
+    {
+        return (hits + misses) ? (double)hits / (hits + misses) : 0.0;
+    }
+};
+
+
+/**
+ * @brief Thread-safe pool of aligned memmory blocks grouped by size classes<br>
+ * (freed blocks are kept and given out again for the same size class, 
+ * so images of the same size do not call malloc/free and do not page fault again)
+ * 
+ */
+class BufferPool
+{
+public:
+
+    /**
+     * @brief Construct a new BufferPool object
+     * 
+     * @param[in] limit maximum number of bytes kept in free blocks
+     */
+    explicit BufferPool(size_t limit = BUFFER_POOL_DEFAULT_LIMIT);
+
+
+    /**
+     * @brief Destroy the BufferPool object (frees all cached blocks)
+     * 
+     */
+    ~BufferPool();
+
+
+    /**
+     * @brief Get the pool used by all images<br>
+     * (it is never destroyed)
+     * 
+     * @return BufferPool& - default pool
+     */
+    static BufferPool& getDefault();
+
+
+    /**
+     * @brief Get a block of at least size bytes aligned to BUFFER_POOL_ALIGNMENT<br>
+     * (the content of the block is undefined)
+     * 
+     * @param[in] size required size in bytes
+     * @param[out] capacity real size of the block (must be passed to release)
+     * @param[out] huge_pages the block is aligned and advised for huge pages (must be passed to release)
+     * @return void* - the block (NULL if there is not enough memmory)
+     */
+    void* acquire(size_t size, size_t *capacity, bool *huge_pages);
+
+
+    /**
+     * @brief Return the block to the pool<br>
+     * (the block is freed if the pool already keeps limit bytes)
+     * 
+     * @param[in] data block received from acquire
+     * @param[in] capacity capacity received from acquire
+     * @param[in] huge_pages huge_pages received from acquire
+     */
+    void release(void *data, size_t capacity, bool huge_pages);
+
+
+    /**
+     * @brief Set the maximum number of bytes kept in free blocks<br>
+     * (extra cached blocks are freed)
+     * 
+     * @param[in] limit limit in bytes (0 - do not cache blocks)
+     */
+    void setLimit(size_t limit);
+
+
+    /**
+     * @brief Enable transparent huge pages for blocks of BUFFER_POOL_HUGE_PAGE_SIZE and more<br>
+     * (such blocks are aligned to BUFFER_POOL_HUGE_PAGE_SIZE, has no effect where not supported)
+     * 
+     * @param[in] enable true or false
+     */
+    void setHugePages(bool enable);
+
+
+    /**
+     * @brief Free all cached blocks
+     * 
+     */
+    void trim();
+
+
+    /**
+     * @brief Get the pool statistics
+     * 
+     * @return BufferPoolStats - statistics
+     */
+    BufferPoolStats getStats();
+
+
+private:
+
+    std::mutex                                              mutex_;
+    std::map<std::pair<size_t, bool>, std::vector<void*>>   free_blocks_;   // by capacity and huge pages
+    size_t                                                  limit_;
+    bool                                                    huge_pages_;
+    BufferPoolStats                                         stats_;
+
+
+    /**
+     * @brief Round size up to its size class<br>
+     * (4 classes per power of two, so at most 25% of a block is unused)
+     * 
+     * @param[in] size size in bytes
+     * @return size_t - size class
+     */
+    static size_t getSizeClass(size_t size);
+
+
+    /**
+     * @brief Allocate a new block
+     * 
+     * @param[in] capacity size of the block (size class)
+     * @param[in] huge_pages align the block to BUFFER_POOL_HUGE_PAGE_SIZE and advise it as huge pages
+     * @return void* - the block (NULL if there is not enough memmory)
+     */
+    void* allocateBlock(size_t capacity, bool huge_pages);
+
+
+    /**
+     * @brief Free cached blocks until cached_bytes <= limit<br>
+     * (mutex_ must be locked)
+     * 
+     * @param[in] limit number of bytes that may stay cached
+     */
+    void shrink(size_t limit);
+};
+
+}
+#endif
@@ -18,6 +18,8 @@
 #define BMP_FILE_ERROR          40
 #define BMP_PROCESSING_ERROR    41
 
+#define BUFFER_ERROR            42
+
 /**
  * @brief namespace of ImageEditor.h
  * 
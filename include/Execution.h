@@ -0,0 +1,121 @@
+/**
+ * @file Execution.h
+ * @brief Header with the execution policies of the pixel loops (forEachPixel, transformPixels, forEachRow)
+ * @version 0.1.0
+ * @date 2026-10-17
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+#ifndef EXECUTION_H
+#define EXECUTION_H
+
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <algorithm>
+
+#define IMAGE_BAND_SIZE                 (256*1024)
+
+/**
+ * @brief namespace of ImageEditor.h
+ * 
+ */
+namespace ie
+{
+
+/**
+ * @brief namespace of the execution policies (the same names as in std::execution)
+ * 
+ */
+namespace execution
+{
+
+/**
+ * @brief Policy for running the loop in the calling thread
+ * 
+ */
+struct sequenced_policy
+{
+    static const bool  parallel    = false;
+    static const bool  unsequenced = false;
+};
+
+
+/**
+ * @brief Policy for running bands of rows on all cores
+ * 
+ */
+struct parallel_policy
+{
+    static const bool  parallel    = true;
+    static const bool  unsequenced = false;
+};
+
+
+/**
+ * @brief Policy for running bands of rows on all cores and vectorizing the loop over a row<br>
+ * (the function must not depend on the order of the pixels in a row)
+ * 
+ */
+struct parallel_unsequenced_policy
+{
+    static const bool  parallel    = true;
+    static const bool  unsequenced = true;
+};
+
+
+constexpr sequenced_policy             seq{};
+constexpr parallel_policy              par{};
+constexpr parallel_unsequenced_policy  par_unseq{};
+
+}
+
+
+/**
+ * @brief Call the function for bands of rows [y0, y1) covering the rows [0, height)<br>
+ * (with a parallel policy the bands are taken in order by one thread per core,
+ * the calling thread is one of them; otherwise the function is called once for all rows)
+ * 
+ * @param[in] policy execution policy (execution::seq, execution::par or execution::par_unseq)
+ * @param[in] height number of rows
+ * @param[in] band_rows number of rows in a band
+ * @param[in] function function taking y0 and y1 of the band
+ */
+template <class ExecutionPolicy, class Function>
+void forEachBand(ExecutionPolicy policy, int height, int band_rows, Function function)
+{
+    if (height <= 0) {
+        return;
+    }
+    band_rows = std::max(1, band_rows);
+    const int band_count = (height + band_rows - 1) / band_rows;
+
+    if (!ExecutionPolicy::parallel || band_count == 1) {
+        function(0, height);
+        return;
+    }
+
+    int thread_count = std::max(1u, std::thread::hardware_concurrency());
+    thread_count = std::min(thread_count, band_count);
+
+    std::atomic<int> next_band(0);
+    auto worker = [&]() {
+        for (int b = next_band++; b < band_count; b = next_band++) {
+            function(b*band_rows, std::min(height, (b + 1)*band_rows));
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (int i = 1; i < thread_count; i++) {
+        threads.emplace_back(worker);
+    }
+    worker();
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+}
+
+}
+#endif
@@ -0,0 +1,893 @@
+/**
+ * @file Image.h
+ * @brief Header with a description and implementation of the Image class template
+ * (the image processing engine shared by ImageBMP and ImagePNG)
+ * @version 0.1.0
+ * @date 2026-10-17
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+#ifndef IMAGE_H
+#define IMAGE_H
+
+#include "Structures.h"
+#include "PixelTraits.h"
+#include "PixelBuffer.h"
+#include "ImageView.h"
+#include <string.h>
+#include <vector>
+#include <utility>
+
+#define IMAGE_ROW_ALIGNMENT             4
+
+#define IMAGE_TURN_180                  0
+#define IMAGE_TURN_90_CLOCKWISE         1
+#define IMAGE_TURN_90_COUNTERCLOCKWISE  2
+
+/**
+ * @brief namespace of ImageEditor.h
+ * 
+ */
+namespace ie
+{
+
+template <class PixelTraits>
+class Image
+{
+public:
+
+    typedef typename PixelTraits::Color Color;
+
+
+    /**
+     * @brief Construct a new empty Image object
+     * 
+     * @param[in] bottom_up rows are stored in memmory from the last to the first (as in BMP files)
+     */
+    explicit Image(bool bottom_up = false);
+
+
+    /**
+     * @brief Construct a copy of the image<br>
+     * (the pixel data is shared until one of the images is changed)
+     * 
+     * @param[in] other image to copy
+     */
+    Image(const Image& other) = default;
+
+
+    /**
+     * @brief Construct an image taking the data of other
+     * 
+     * @param[in] other image to move (becomes empty)
+     */
+    Image(Image&& other) noexcept;
+
+
+    /**
+     * @brief Copy the image<br>
+     * (the pixel data is shared until one of the images is changed)
+     * 
+     * @param[in] other image to copy
+     * @return Image& - this image
+     */
+    Image& operator=(const Image& other) = default;
+
+
+    /**
+     * @brief Take the data of other
+     * 
+     * @param[in] other image to move (becomes empty)
+     * @return Image& - this image
+     */
+    Image& operator=(Image&& other) noexcept;
+
+
+    /**
+     * @brief Get the Width object
+     * 
+     * @return int - image width
+     */
+    int getWidth();
+
+
+    /**
+     * @brief Get the Height image
+     * 
+     * @return int - image height
+     */
+    int getHeight();
+
+
+    /**
+     * @brief Get the size of the pixel data held by the image<br>
+     * (stride * height: the rows with their padding in the pixel format of the image)
+     * 
+     * @return size_t - size in bytes
+     */
+    size_t getDataSize();
+
+
+    /**
+     * @brief Get the pixel color
+     * 
+     * @param[in] x the X coordinate of the pixel
+     * @param[in] y the Y coordinate of the pixel
+     * @return Color - pixel color (all components are 0 outside the image)
+     */
+    Color getColor(int x, int y);
+
+
+    /**
+     * @brief Set the pixel color
+     * 
+     * @param[in] x the X coordinate of the pixel
+     * @param[in] y the Y coordinate of the pixel
+     * @param[in] color pixel color
+     */
+    void setColor(int x, int y, Color color);
+
+
+    /**
+     * @brief Set the Size image<br>
+     * (sets all components of all pixels to 0)
+     * 
+     * @param[in] width image wigth
+     * @param[in] height image height
+     */
+    void setSize(int width, int height);
+
+
+    /**
+     * @brief Clear the image<br>
+     * (sets all components of all pixels to 0)
+     * 
+     */
+    void clear();
+
+
+    /**
+     * @brief Resize the image and insert the original one at the position x0, y0 for the upper-left corner)
+     * 
+     * @param[in] x0 the X coordinate of the upper-left corner of the original image insertion
+     * @param[in] y0 the Y coordinate of the upper-left corner of the original image insertion
+     * @param[in] new_width new image width
+     * @param[in] new_height new image height
+     */
+    void resize(int x0, int y0, int new_width, int new_height);
+
+
+    /**
+     * @brief Insert an image at the position x0, y0 for the upper-left corner
+     * 
+     * @param[in] src_image image to copy
+     * @param[in] x0 the X coordinate of upper left corner of insertion
+     * @param[in] y0 the Y coordinate of upper left corner of insertion
+     */
+    void paste(Image& src_image, int x0, int y0);
+
+
+    /**
+     * @brief Insert pixels of a view at the position x0, y0 for the upper-left corner
+     * 
+     * @param[in] src_view pixels to copy (may be a view of this image)
+     * @param[in] x0 the X coordinate of upper left corner of insertion
+     * @param[in] y0 the Y coordinate of upper left corner of insertion
+     */
+    void paste(ImageView<PixelTraits> src_view, int x0, int y0);
+
+
+    /**
+     * @brief Make the image a copy of the pixels of a view<br>
+     * (materializes a view, the image gets the size of the view)
+     * 
+     * @param[in] src_view pixels to copy (may be a view of this image)
+     */
+    void copyFrom(ImageView<PixelTraits> src_view);
+
+
+    /**
+     * @brief Get a view of the whole image for reading and changing it<br>
+     * (the view is valid until the image is resized, copied, read from a file or destroyed)
+     * 
+     * @return ImageView<PixelTraits> - view of the image
+     */
+    ImageView<PixelTraits> view();
+
+
+    /**
+     * @brief Get a view of a part of the image for reading and changing it<br>
+     * (the area is clipped to the image)<br>
+     * (the view is valid until the image is resized, copied, read from a file or destroyed)
+     * 
+     * @param[in] x0 the X coordinate of upper left corner of the area
+     * @param[in] y0 the Y coordinate of upper left corner of the area
+     * @param[in] x1 the X coordinate of lower right corner of the area
+     * @param[in] y1 the Y coordinate of lower right corner of the area
+     * @return ImageView<PixelTraits> - view of the area
+     */
+    ImageView<PixelTraits> view(int x0, int y0, int x1, int y1);
+
+
+    /**
+     * @brief Get a view of the whole image for reading only<br>
+     * (unlike view() it does not copy pixel data shared with other images, 
+     * so the pixels must not be changed through it)
+     * 
+     * @return ImageView<PixelTraits> - view of the image
+     */
+    ImageView<PixelTraits> constView();
+
+
+    /**
+     * @brief Get a view of a part of the image for reading only<br>
+     * (unlike view() it does not copy pixel data shared with other images, 
+     * so the pixels must not be changed through it)
+     * 
+     * @param[in] x0 the X coordinate of upper left corner of the area
+     * @param[in] y0 the Y coordinate of upper left corner of the area
+     * @param[in] x1 the X coordinate of lower right corner of the area
+     * @param[in] y1 the Y coordinate of lower right corner of the area
+     * @return ImageView<PixelTraits> - view of the area
+     */
+    ImageView<PixelTraits> constView(int x0, int y0, int x1, int y1);
+
+
+    /**
+     * @brief Rotate the image at angles multiple of 90
+     * 
+     * @param[in] rotation_type type of rotation (TURN_180, TURN_90_CLOCKWISE or TURN_90_COUNTERCLOCKWISE)
+     */
+    void rotate(int rotation_type);
+
+
+    /**
+     * @brief Reflect the image
+     * 
+     * @param[in] reflection_type type of reflection (format can be: VERTICAL or HORIZONTAL)
+     */
+    void reflect(int reflection_type);
+
+
+    /**
+     * @brief Draw Bresenham line<br>
+     * (line with thickness 1)
+     * 
+     * @param[in] x0 the X coordinate of the beginning of the line
+     * @param[in] y0 the Y coordinate of the beginning of the line
+     * @param[in] x1 the X coordinate of the end of the line
+     * @param[in] y1 the Y coordinate of the end of the line
+     * @param[in] color line color
+     */
+    void drawBresenhamLine(int x0, int y0, int x1, int y1, Color color);
+
+
+    /**
+     * @brief Draw Bresenham line<br>
+     * (line with any thickness)<br>
+     * (thickness is set by drawing parallel lines by the Bresenham algorithm)
+     * 
+     * @param[in] x0 the X coordinate of the beginning of the line
+     * @param[in] y0 the Y coordinate of the beginning of the line
+     * @param[in] x1 the X coordinate of the end of the line
+     * @param[in] y1 the Y coordinate of the end of the line
+     * @param[in] color line color
+     */
+    void drawMurphyLine(int x0, int y0, int x1, int y1,
+        int thickness, Color color);
+
+
+    /**
+     * @brief Draw line<br>
+     * (line with any thickness)<br>
+     * (thickness is set by drawing circles at each point of the line)
+     * 
+     * @param[in] x0 the X coordinate of the beginning of the line
+     * @param[in] y0 the Y coordinate of the beginning of the line
+     * @param[in] x1 the X coordinate of the end of the line
+     * @param[in] y1 the Y coordinate of the end of the line
+     * @param[in] thickness thickenss of the line
+     * @param[in] color line color
+     */
+    void drawLine(int x0, int y0, int x1, int y1,
+        int thickness, Color color);
+
+
+    /**
+     * @brief Draw Bresenham circle<br>
+     * (circle with thickness 1)
+     * 
+     * @param[in] x0 the X coordinate of the center of the circle
+     * @param[in] y0 the X coordinate of the center of the circle
+     * @param[in] radius circle radius
+     * @param[in] color circle color
+     */
+    void drawBresenhamCircle(int x0, int y0, int radius, Color color);
+
+
+    /**
+     * @brief Draw circle<br>
+     * (circle with any thickness)
+     * 
+     * @param[in] x0 the X coordinate of the center of the circle
+     * @param[in] y0 the X coordinate of the center of the circle
+     * @param[in] radius circle radius
+     * @param[in] thickness circle thickness
+     * @param[in] color circle color
+     * @param[in] fill should it be filled in (format can be: true or false)
+     * @param[in] fill_color circle fill color
+     */
+    void drawCircle(int x0, int y0, int radius, int thickness,
+        Color color, bool fill, Color fill_color);
+
+
+    /**
+     * @brief Draw polygon<br>
+     * (polygon with any thickness)<br>
+     * (used alg: scan line)
+     * 
+     * @param[in] vertices the vector of polygon coordinates in the order of their connection
+     * @param[in] thickness polygon thickness
+     * @param[in] color polygon color
+     * @param[in] fill should it be filled in (true or false)
+     * @param[in] fill_color polygon fill color
+     */
+    void drawPolygon(std::vector<Coord> vertices, int thickness,
+        Color color, bool fill, Color fill_color);
+
+
+    /**
+     * @brief Check if point is in polygon
+     * 
+     * @param[in] x the X coordinate of point
+     * @param[in] y the X coordinate of point
+     * @param[in] vertices the vector of polygon coordinates in the order of their connection
+     * @return true - point is in the polygon
+     * @return false - point is not in the polygon
+     */
+    bool inPolygon(int x, int y, std::vector<Coord>& vertices);
+
+
+    /**
+     * @brief Replace a certain color with a new one
+     * 
+     * @param[in] old_color old color
+     * @param[in] new_color new color
+     */
+    void colorReplace(Color old_color, Color new_color);
+
+
+    /**
+     * @brief Replace a certain color component
+     * 
+     * @param[in] component_idx color component (format can be: R_IDX, G_IDX or B_IDX)
+     * @param[in] component_value the new value of the component (format: [0..255])
+     */
+    void componentFilter(int component_idx, unsigned char component_value);
+
+
+    /**
+     * @brief Inverts the colors of the image
+     * 
+     */
+    void inverseColors();
+
+
+    /**
+     * @brief Converts the image to black and white
+     * 
+     * @param[in] method gray method (format can be: GRAY_BT601, GRAY_BT709, GRAY_AVERAGE or GRAY_LIGHTNESS)
+     */
+    void grayColors(int method = GRAY_BT601);
+
+
+    /**
+     * @brief Fill area with color
+     * 
+     * @param[in] x the X coordinate of the beginning of the fill
+     * @param[in] y the Y coordinate of the beginning of the fill
+     * @param[in] color fill color
+     */
+    void floodFill(int x, int y, Color color);
+
+
+    /**
+     * @brief Call the function for every row of the image<br>
+     * (see ImageView::forEachRow)
+     * 
+     * @param[in] policy execution policy (execution::seq, execution::par or execution::par_unseq)
+     * @param[in] function function taking the Y coordinate and the PixelSpan of the row
+     */
+    template <class ExecutionPolicy, class Function>
+    void forEachRow(ExecutionPolicy policy, Function function)
+    {
+        view().forEachRow(policy, function);
+    }
+
+
+    /**
+     * @brief Call the function for every pixel of the image without changing it<br>
+     * (see ImageView::forEachPixel)
+     * 
+     * @param[in] policy execution policy (execution::seq, execution::par or execution::par_unseq)
+     * @param[in] function function taking the X and Y coordinates and the color of the pixel
+     */
+    template <class ExecutionPolicy, class Function>
+    void forEachPixel(ExecutionPolicy policy, Function function)
+    {
+        constView().forEachPixel(policy, function);
+    }
+
+
+    /**
+     * @brief Replace the color of every pixel with the result of the function<br>
+     * (see ImageView::transformPixels)
+     * 
+     * @param[in] policy execution policy (execution::seq, execution::par or execution::par_unseq)
+     * @param[in] function function taking the color of the pixel and returning the new color
+     */
+    template <class ExecutionPolicy, class Function>
+    void transformPixels(ExecutionPolicy policy, Function function)
+    {
+        view().transformPixels(policy, function);
+    }
+
+
+protected:
+
+    int                  width_;
+    int                  height_;
+    int                  stride_;
+    bool                 bottom_up_;
+    PixelBuffer          buffer_;
+
+
+    /**
+     * @brief Get the size of a stored row in bytes<br>
+     * (width * pixel size rounded up to IMAGE_ROW_ALIGNMENT)
+     * 
+     * @param[in] width row width in pixels
+     * @return int - row size in bytes
+     */
+    static int rowStride(int width);
+
+
+    /**
+     * @brief Allocate memmory for image data (width_ * height_)<br>
+     * (one block of stride_ * height_ bytes in buffer_, the content is undefined)
+     * 
+     */
+    void allocateMemmory();
+
+
+    /**
+     * @brief Use a part of a file mapped into memmory as image data (width_ * height_)<br>
+     * (the file must store stride_ * height_ bytes of rows in the order set by bottom_up_)
+     * 
+     * @param[in] file_name name of the file
+     * @param[in] offset position of the first stored row in the file
+     * @param[in] writable false - read-only mapping (copied on the first change)<br>
+     * true - private copy-on-write mapping
+     * @return true - if the file was mapped
+     * @return false - if the file could not be mapped (the image has no data)
+     */
+    bool mapMemmory(const char *file_name, size_t offset, bool writable);
+
+
+    /**
+     * @brief Free memmory for image data
+     * 
+     */
+    void freeMemmory();
+
+
+    /**
+     * @brief Make the image data unshared before changing it<br>
+     * (copy-on-write)
+     * 
+     */
+    void makeWritable();
+
+
+    /**
+     * @brief Read the image data of a deferred block now<br>
+     * (writers call it before opening the output, which can be the file the data is read from)
+     * 
+     */
+    void ensureLoaded();
+
+
+    /**
+     * @brief Get the first byte of the row
+     * 
+     * @param[in] y the Y coordinate of the row
+     * @return unsigned char* - pointer to the row
+     */
+    unsigned char* row(int y);
+
+
+    /**
+     * @brief Copy a part of the image to copy_image<br>
+     * (used by copy of the derived classes)
+     * 
+     * @param[out] copy_image image with copied area
+     * @param[in] x0 the X coordinate of upper left corner of the copy area
+     * @param[in] y0 the Y coordinate of upper left corner of the copy area
+     * @param[in] x1 the X coordinate of lower right corner of the copy area
+     * @param[in] y1 the Y coordinate of lower right corner of the copy area
+     */
+    void copyArea(Image& copy_image, int x0, int y0, int x1, int y1);
+};
+
+
+/*
+ * Image data (allocation, copy-on-write, pixel access)
+ */
+
+template <class PixelTraits>
+Image<PixelTraits>::Image(bool bottom_up) :
+    width_(0),
+    height_(0),
+    stride_(0),
+    bottom_up_(bottom_up),
+    buffer_()
+{}
+
+template <class PixelTraits>
+Image<PixelTraits>::Image(Image&& other) noexcept :
+    width_(other.width_),
+    height_(other.height_),
+    stride_(other.stride_),
+    bottom_up_(other.bottom_up_),
+    buffer_(std::move(other.buffer_))
+{
+    other.width_ = 0;
+    other.height_ = 0;
+    other.stride_ = 0;
+}
+
+template <class PixelTraits>
+Image<PixelTraits>& Image<PixelTraits>::operator=(Image&& other) noexcept
+{
+    if (this != &other) {
+        width_ = other.width_;
+        height_ = other.height_;
+        stride_ = other.stride_;
+        bottom_up_ = other.bottom_up_;
+        buffer_ = std::move(other.buffer_);
+
+        other.width_ = 0;
+        other.height_ = 0;
+        other.stride_ = 0;
+    }
+    return *this;
+}
+
+template <class PixelTraits>
+int Image<PixelTraits>::rowStride(int width)
+{
+    return (width*PixelTraits::pixel_size + IMAGE_ROW_ALIGNMENT-1) & (-IMAGE_ROW_ALIGNMENT);
+}
+
+template <class PixelTraits>
+void Image<PixelTraits>::allocateMemmory()
+{
+    freeMemmory();
+
+    stride_ = rowStride(width_);
+    if (width_ <= 0 || height_ <= 0) {
+        return;
+    }
+
+    buffer_.allocate((size_t)stride_*height_);
+}
+
+template <class PixelTraits>
+bool Image<PixelTraits>::mapMemmory(const char *file_name, size_t offset, bool writable)
+{
+    freeMemmory();
+
+    stride_ = rowStride(width_);
+    if (width_ <= 0 || height_ <= 0) {
+        return false;
+    }
+
+    return buffer_.mapFile(file_name, offset, (size_t)stride_*height_, writable);
+}
+
+template <class PixelTraits>
+void Image<PixelTraits>::freeMemmory()
+{
+    buffer_.release();
+}
+
+template <class PixelTraits>
+void Image<PixelTraits>::makeWritable()
+{
+    buffer_.detach();
+}
+
+template <class PixelTraits>
+void Image<PixelTraits>::ensureLoaded()
+{
+    buffer_.getData();
+}
+
+template <class PixelTraits>
+unsigned char* Image<PixelTraits>::row(int y)
+{
+    return buffer_.getData() + (size_t)stride_*(bottom_up_ ? height_ - y - 1 : y);
+}
+
+template <class PixelTraits>
+ImageView<PixelTraits> Image<PixelTraits>::view()
+{
+    makeWritable();
+    return constView();
+}
+
+template <class PixelTraits>
+ImageView<PixelTraits> Image<PixelTraits>::view(int x0, int y0, int x1, int y1)
+{
+    return view().subView(x0, y0, x1, y1);
+}
+
+template <class PixelTraits>
+ImageView<PixelTraits> Image<PixelTraits>::constView()
+{
+    if (!buffer_.getData()) {
+        return ImageView<PixelTraits>();
+    }
+    return ImageView<PixelTraits>(row(0), width_, height_, bottom_up_ ? -stride_ : stride_);
+}
+
+template <class PixelTraits>
+ImageView<PixelTraits> Image<PixelTraits>::constView(int x0, int y0, int x1, int y1)
+{
+    return constView().subView(x0, y0, x1, y1);
+}
+
+template <class PixelTraits>
+typename Image<PixelTraits>::Color Image<PixelTraits>::getColor(int x, int y)
+{
+    return constView().getColor(x, y);
+}
+
+template <class PixelTraits>
+void Image<PixelTraits>::setColor(int x, int y, Color color)
+{
+    view().setColor(x, y, color);
+}
+
+
+/*
+ * Process shape (getWidth, getHeight, setSize, etc.)
+ */
+
+template <class PixelTraits>
+int Image<PixelTraits>::getWidth()
+{
+    return width_;
+}
+
+template <class PixelTraits>
+int Image<PixelTraits>::getHeight()
+{
+    return height_;
+}
+
+template <class PixelTraits>
+size_t Image<PixelTraits>::getDataSize()
+{
+    return buffer_.getSize();
+}
+
+template <class PixelTraits>
+void Image<PixelTraits>::setSize(int width, int height)
+{
+    width_ = width;
+    height_ = height;
+
+    allocateMemmory();
+
+    clear();
+}
+
+template <class PixelTraits>
+void Image<PixelTraits>::resize(int x0, int y0, int new_width, int new_height)
+{
+    Image copy_image(*this);
+    setSize(new_width, new_height);
+    this->paste(copy_image, x0, y0);
+}
+
+template <class PixelTraits>
+void Image<PixelTraits>::copyArea(Image& copy_image, int x0, int y0, int x1, int y1)
+{
+    if (x0 > x1) {
+        std::swap(x0, x1);
+    }
+    if (y0 > y1) {
+        std::swap(y0, y1);
+    }
+
+    if (x0 == 0 && y0 == 0 && x1 == width_-1 && y1 == height_-1) {
+        copy_image = *this;
+        return;
+    }
+
+    if (x0 >= 0 && y0 >= 0 && x1 < width_ && y1 < height_) {
+        copy_image.copyFrom(constView(x0, y0, x1, y1));
+        return;
+    }
+
+    copy_image.setSize(x1-x0+1, y1-y0+1);
+    copy_image.paste(constView(), -x0, -y0);
+}
+
+template <class PixelTraits>
+void Image<PixelTraits>::copyFrom(ImageView<PixelTraits> src_view)
+{
+    Image copy_image(bottom_up_);
+    copy_image.width_ = src_view.getWidth();
+    copy_image.height_ = src_view.getHeight();
+    copy_image.allocateMemmory();
+    copy_image.constView().paste(src_view, 0, 0);
+    *this = std::move(copy_image);
+}
+
+template <class PixelTraits>
+void Image<PixelTraits>::paste(Image& src_image, int x0, int y0)
+{
+    paste(src_image.constView(), x0, y0);
+}
+
+template <class PixelTraits>
+void Image<PixelTraits>::paste(ImageView<PixelTraits> src_view, int x0, int y0)
+{
+    view().paste(src_view, x0, y0);
+}
+
+template <class PixelTraits>
+void Image<PixelTraits>::rotate(int rotation_type)
+{
+    if (rotation_type == IMAGE_TURN_180) {
+        reflect(IMAGE_VERTICAL);
+        reflect(IMAGE_HORIZONTAL);
+        return;
+    }
+
+    Image copy_image(*this);
+    ImageView<PixelTraits> src_view = copy_image.constView();
+
+    if (rotation_type == IMAGE_TURN_90_CLOCKWISE) {
+        setSize(height_, width_);
+        ImageView<PixelTraits> dst_view = view();
+        for (int y = 0; y < height_; y++) {
+            for (int x = 0; x < width_; x++) {
+                dst_view.setAt(x, y, src_view.at(y, width_ - x - 1));
+            }
+        }
+    }
+    if (rotation_type == IMAGE_TURN_90_COUNTERCLOCKWISE) {
+        setSize(height_, width_);
+        ImageView<PixelTraits> dst_view = view();
+        for (int y = 0; y < height_; y++) {
+            for (int x = 0; x < width_; x++) {
+                dst_view.setAt(x, y, src_view.at(height_ - y - 1, x));
+            }
+        }
+    }
+}
+
+template <class PixelTraits>
+void Image<PixelTraits>::reflect(int reflection_type)
+{
+    view().reflect(reflection_type);
+}
+
+
+/*
+ * Process colors (inverse (inverse colors), gray (convert to black and white), etc.)
+ */
+
+template <class PixelTraits>
+void Image<PixelTraits>::clear()
+{
+    if (buffer_.getSize() > 0 && (!buffer_.isWritable() || !buffer_.isLoaded())) {
+        buffer_.allocate(buffer_.getSize());
+    }
+    if (buffer_.getData()) {
+        memset(buffer_.getData(), 0, buffer_.getSize());
+    }
+}
+
+template <class PixelTraits>
+void Image<PixelTraits>::colorReplace(Color old_color, Color new_color)
+{
+    view().colorReplace(old_color, new_color);
+}
+
+template <class PixelTraits>
+void Image<PixelTraits>::componentFilter(int component_idx, unsigned char component_value)
+{
+    view().componentFilter(component_idx, component_value);
+}
+
+template <class PixelTraits>
+void Image<PixelTraits>::inverseColors()
+{
+    view().inverseColors();
+}
+
+template <class PixelTraits>
+void Image<PixelTraits>::grayColors(int method)
+{
+    view().grayColors(method);
+}
+
+template <class PixelTraits>
+void Image<PixelTraits>::floodFill(int x, int y, Color color)
+{
+    view().floodFill(x, y, color);
+}
+
+
+/*
+ * Drawing (lines, circles, polygons)
+ */
+
+template <class PixelTraits>
+void Image<PixelTraits>::drawBresenhamLine(int x0, int y0, int x1, int y1, Color color)
+{
+    view().drawBresenhamLine(x0, y0, x1, y1, color);
+}
+
+template <class PixelTraits>
+void Image<PixelTraits>::drawMurphyLine(int x0, int y0, int x1, int y1,
+    int thickness, Color color)
+{
+    view().drawMurphyLine(x0, y0, x1, y1, thickness, color);
+}
+
+template <class PixelTraits>
+void Image<PixelTraits>::drawLine(int x0, int y0, int x1, int y1,
+    int thickness, Color color)
+{
+    view().drawLine(x0, y0, x1, y1, thickness, color);
+}
+
+template <class PixelTraits>
+void Image<PixelTraits>::drawBresenhamCircle(int x0, int y0, int radius, Color color)
+{
+    view().drawBresenhamCircle(x0, y0, radius, color);
+}
+
+template <class PixelTraits>
+void Image<PixelTraits>::drawCircle(int x0, int y0, int radius, int thickness,
+    Color color, bool fill, Color fill_color)
+{
+    view().drawCircle(x0, y0, radius, thickness, color, fill, fill_color);
+}
+
+template <class PixelTraits>
+void Image<PixelTraits>::drawPolygon(std::vector<Coord> vertices, int thickness,
+    Color color, bool fill, Color fill_color)
+{
+    view().drawPolygon(vertices, thickness, color, fill, fill_color);
+}
+
+template <class PixelTraits>
+bool Image<PixelTraits>::inPolygon(int x, int y, std::vector<Coord>& vertices)
+{
+    return constView().inPolygon(x, y, vertices);
+}
+
+
+extern template class Image<PixelBGR>;
+extern template class Image<PixelRGBA>;
+
+}
+#endif
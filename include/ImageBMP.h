@@ -12,18 +12,30 @@
 #define IMAGE_BMP_H
 
 #include "Structures.h"
+#include "Image.h"
 #include <vector>
+#include <stdint.h>
+#include <functional>
 
 #define BMP_SIGNATURE                 0x4d42
 #define BMP_BITS_PER_PIXEL            24
 #define BMP_COMPRESSION               0
+#define BMP_CHANNELS                  3
+#define BMP_COLOR_TYPE                2     // the value of PNG_COLOR_TYPE_RGB
 
-#define BMP_TURN_180                  0
-#define BMP_TURN_90_CLOCKWISE         1
-#define BMP_TURN_90_COUNTERCLOCKWISE  2
+#define BMP_READ_COPY                 0
+#define BMP_READ_MAP                  1
+#define BMP_READ_MAP_PRIVATE          2
+#define BMP_READ_LAZY                 3
 
-#define BMP_VERTICAL                  0
-#define BMP_HORIZONTAL                1
+#define BMP_STREAM_BAND_HEIGHT        64
+
+#define BMP_TURN_180                  IMAGE_TURN_180
+#define BMP_TURN_90_CLOCKWISE         IMAGE_TURN_90_CLOCKWISE
+#define BMP_TURN_90_COUNTERCLOCKWISE  IMAGE_TURN_90_COUNTERCLOCKWISE
+
+#define BMP_VERTICAL                  IMAGE_VERTICAL
+#define BMP_HORIZONTAL                IMAGE_HORIZONTAL
 
 /**
  * @brief namespace of ImageEditor.h
@@ -33,25 +45,27 @@ namespace ie
 {
 
 /**
- * @brief Class for working with BMP files
+ * @brief Class for working with BMP files<br>
+ * (image processing methods are inherited from Image)
  * 
  */
-class ImageBMP
+class ImageBMP : public Image<PixelBGR>
 {
 public:
 
     /**
-     * @brief Construct a new ImageBMP object
+     * @brief Function called by processFile for every band of rows<br>
+     * (band - view of the rows, y - the Y coordinate of the first row of the band in the image)
      * 
      */
-    ImageBMP();
+    typedef std::function<void(ImageView<PixelBGR> band, int y)> BandCallback;
 
 
     /**
-     * @brief Destroy the ImageBMP object
+     * @brief Construct a new ImageBMP object
      * 
      */
-    ~ImageBMP();
+    ImageBMP();
 
 
     /**
@@ -62,84 +76,114 @@ public:
 
 
     /**
-     * @brief Get the Width object
+     * @brief Read an image from a BMP file
      * 
-     * @return int - image width
+     * @param[in] input_file_name input file name
+     * @param[in] read_mode how the pixel data is loaded (format can be:<br>
+     * BMP_READ_COPY - read into memmory,<br>
+     * BMP_READ_MAP - map the file read-only, the data is copied on the first change,<br>
+     * BMP_READ_MAP_PRIVATE - map the file copy-on-write, changed pages are copied by the system,<br>
+     * BMP_READ_LAZY - read only the headers, the pixel data is read into memmory on the first access)<br>
+     * (with mapping the file is read on access, so opening does not depend on the image size; 
+     * the file must not be truncated while the image uses it; with BMP_READ_LAZY 
+     * it must not be changed until the first access; writeImageToFile reads it first, 
+     * so the image can be written back to the same file)
      */
-    int getWidth();
-    
+    void readImageFromFile(const char *input_file_name, int read_mode = BMP_READ_COPY);
+
 
     /**
-     * @brief Get the Height image
+     * @brief Read a reduced copy of the image from a BMP file<br>
+     * (every scale-th pixel of every scale-th row is kept, the size is rounded up; 
+     * only the kept rows are read from the file, so the full-size image is never allocated)
      * 
-     * @return int - image height
+     * @param[in] input_file_name input file name
+     * @param[in] scale reduction (format can be: 1, 2, 4 or 8)
      */
-    int getHeight();
+    void readScaledImageFromFile(const char *input_file_name, int scale);
 
 
     /**
-     * @brief Get the pixel ColorBGR 
+     * @brief Read a part of the image from a BMP file<br>
+     * (the area is clipped to the image; only the area is read from the file, 
+     * so the time and memmory depend only on the area size)
      * 
-     * @param[in] x the X coordinate of the pixel
-     * @param[in] y the Y coordinate of the pixel
-     * @return ColorBGR - pixel color
+     * @param[in] input_file_name input file name
+     * @param[in] x0 the X coordinate of upper left corner of the area
+     * @param[in] y0 the Y coordinate of upper left corner of the area
+     * @param[in] x1 the X coordinate of lower right corner of the area
+     * @param[in] y1 the Y coordinate of lower right corner of the area
      */
-    ColorBGR getColor(int x, int y);
+    void readAreaFromFile(const char *input_file_name, int x0, int y0, int x1, int y1);
 
 
     /**
-     * @brief Set the ColorBGR object
+     * @brief Read the size and format of a BMP file without reading the pixel data
      * 
-     * @param[in] x the X coordinate of the pixel
-     * @param[in] y the Y coordinate of the pixel
-     * @param[in] color pixel color
+     * @param[in] input_file_name input file name
+     * @param[out] info image metadata
+     * @return true - if the file is a BMP file that readImageFromFile can read
+     * @return false - if the file could not be opened or has another format
      */
-    void setColor(int x, int y, ColorBGR color);
+    static bool probeFile(const char *input_file_name, ImageInfo& info);
 
 
     /**
-     * @brief Set the Size image<br>
-     * (sets the color value for all pixels {0, 0, 0})
+     * @brief Read the size and format of BMP data in memmory without reading the pixel data
      * 
-     * @param[in] width image wigth
-     * @param[in] height image height
+     * @param[in] data BMP file data (at least the headers)
+     * @param[in] size data size in bytes
+     * @param[out] info image metadata
+     * @return true - if the data is a BMP file that readImageFromMemory can read
+     * @return false - if the data has another format
      */
-    void setSize(int width, int height);
+    static bool probeMemory(const void *data, size_t size, ImageInfo& info);
 
 
     /**
-     * @brief Read an image from a BMP file
+     * @brief Read an image from BMP data in memmory<br>
+     * (the pixel data is copied, data can be freed after the call)
      * 
-     * @param[in] input_file_name input file name
+     * @param[in] data BMP file data
+     * @param[in] size data size in bytes
      */
-    void readImageFromFile(const char *input_file_name);
+    void readImageFromMemory(const void *data, size_t size);
 
 
     /**
-     * @brief Write an image to a BMP file
+     * @brief Write an image to a BMP file<br>
+     * (the headers are recomputed from the current size and the whole file is written 
+     * with one call, the file space is reserved in advance where the system allows it)
      * 
      * @param[in] output_file_name output file name
      */
     void writeImageToFile(const char *output_file_name);
 
+
     /**
-     * @brief Clear the image<br>
-     * (sets the color value for all pixels {0, 0, 0})
+     * @brief Write an image as BMP data to memmory
      * 
+     * @param[out] output_buffer BMP file data (the previous content is replaced)
      */
-    void clear();
+    void writeImageToBuffer(std::vector<uint8_t>& output_buffer);
 
 
     /**
-     * @brief Resize the image and insert the original one at the position x0, y0 for the upper-left corner)
+     * @brief Process a BMP file band by band and write the result to another BMP file<br>
+     * (only one band of rows is kept in memmory, so the image can be larger than RAM; 
+     * the bands come in the order of the rows in the file, for the usual bottom-up files 
+     * from the bottom of the image to the top)<br>
+     * (suitable for per-pixel operations of ImageView: inverseColors, grayColors, 
+     * componentFilter, colorReplace, etc.)
      * 
-     * @param[in] x0 the X coordinate of the upper-left corner of the original image insertion
-     * @param[in] y0 the Y coordinate of the upper-left corner of the original image insertion
-     * @param[in] new_width new image width
-     * @param[in] new_height new image height
+     * @param[in] input_file_name input file name
+     * @param[in] output_file_name output file name (must differ from the input file)
+     * @param[in] callback function that changes each band
+     * @param[in] band_height number of rows in a band
      */
-    void resize(int x0, int y0, int new_width, int new_height);
-    
+    static void processFile(const char *input_file_name, const char *output_file_name, 
+                            const BandCallback& callback, int band_height = BMP_STREAM_BAND_HEIGHT);
+
 
     /**
      * @brief Return a new object of the ImageBMP class, which is part of the image
@@ -151,140 +195,6 @@ public:
      * @return ImageBMP - copied area
      */
     ImageBMP copy(int x0, int y0, int x1, int y1);
-    
-
-    /**
-     * @brief Insert an image at the position x0, y0 for the upper-left corner
-     * 
-     * @param[in] src_image image to copy
-     * @param[in] x0 the X coordinate of upper left corner of insertion
-     * @param[in] y0 the Y coordinate of upper left corner of insertion
-     */
-    void paste(ImageBMP& src_image, int x0, int y0);
-
-    
-    /**
-     * @brief Rotate the image at angles multiple of 90
-     * 
-     * @param[in] rotation_type type of rotation (TURN_180, TURN_90_CLOCKWISE or TURN_90_COUNTERCLOCKWISE)
-     */
-    void rotate(int rotation_type);
-
-
-    /**
-     * @brief Reflect the image
-     * 
-     * @param[in] reflection_type type of reflection (format can be: VERTICAL or HORIZONTAL)
-     */
-    void reflect(int reflection_type);
-
-    
-    /**
-     * @brief Draw Bresenham line<br>
-     * (line with thickness 1)
-     * 
-     * @param[in] x0 the X coordinate of the beginning of the line
-     * @param[in] y0 the Y coordinate of the beginning of the line
-     * @param[in] x1 the X coordinate of the end of the line
-     * @param[in] y1 the Y coordinate of the end of the line
-     * @param[in] color line color
-     */
-    void drawBresenhamLine(int x0, int y0, int x1, int y1, ColorBGR color);
-
-
-    /**
-     * @brief Draw Bresenham line<br>
-     * (line with any thickness)<br>
-     * (thickness is set by drawing parallel lines by the Bresenham algorithm)
-     * 
-     * @param[in] x0 the X coordinate of the beginning of the line
-     * @param[in] y0 the Y coordinate of the beginning of the line
-     * @param[in] x1 the X coordinate of the end of the line
-     * @param[in] y1 the Y coordinate of the end of the line
-     * @param[in] color line color
-     */
-    void drawMurphyLine(int x0, int y0, int x1, int y1, 
-        int thickness, ColorBGR color);
-
-
-    /**
-     * @brief Draw line<br>
-     * (line with any thickness)<br>
-     * (thickness is set by drawing circles at each point of the line)
-     * 
-     * @param[in] x0 the X coordinate of the beginning of the line
-     * @param[in] y0 the Y coordinate of the beginning of the line
-     * @param[in] x1 the X coordinate of the end of the line
-     * @param[in] y1 the Y coordinate of the end of the line
-     * @param[in] thickness thickenss of the line
-     * @param[in] color line color
-     */
-    void drawLine(int x0, int y0, int x1, int y1, 
-        int thickness, ColorBGR color);
-
-
-    /**
-     * @brief Draw Bresenham circle<br>
-     * (circle with thickness 1)
-     * 
-     * @param[in] x0 the X coordinate of the center of the circle
-     * @param[in] y0 the X coordinate of the center of the circle
-     * @param[in] radius circle radius
-     * @param[in] color circle color
-     */
-    void drawBresenhamCircle(int x0, int y0, int radius, ColorBGR color);
-
-
-    /**
-     * @brief Draw circle<br>
-     * (circle with any thickness)
-     * 
-     * @param[in] x0 the X coordinate of the center of the circle
-     * @param[in] y0 the X coordinate of the center of the circle
-     * @param[in] radius circle radius
-     * @param[in] thickness circle thickness
-     * @param[in] color circle color
-     * @param[in] fill should it be filled in (format can be: true or false)
-     * @param[in] fill_color circle fill color
-     */
-    void drawCircle(int x0, int y0, int radius, int thickness, 
-        ColorBGR color, bool fill, ColorBGR fill_color);
-
-
-    /**
-     * @brief Draw polygon<br>
-     * (polygon with any thickness)<br>
-     * (used alg: scan line)
-     * 
-     * @param[in] vertices the vector of polygon coordinates in the order of their connection
-     * @param[in] thickness polygon thickness
-     * @param[in] color polygon color
-     * @param[in] fill should it be filled in (true or false)
-     * @param[in] fill_color polygon fill color
-     */
-    void drawPolygon(std::vector<Coord> vertices, int thickness, 
-        ColorBGR color, bool fill, ColorBGR fill_color);
-
-
-    /**
-     * @brief Check if point is in polygon
-     * 
-     * @param[in] x the X coordinate of point
-     * @param[in] y the X coordinate of point
-     * @param[in] vertices the vector of polygon coordinates in the order of their connection
-     * @return true - point is in the polygon
-     * @return false - point is not in the polygon
-     */
-    bool inPolygon(int x, int y, std::vector<Coord>& vertices);
-    
-
-    /**
-     * @brief Replace a certain color with a new one
-     * 
-     * @param[in] old_color old color (foramat: {R, G, B, A})
-     * @param[in] new_color new color (format: {R, G, B, A})
-     */
-    void colorReplace(ColorBGR old_color, ColorBGR new_color);
 
 
     /**
@@ -296,30 +206,6 @@ public:
     void bgrFilter(int component_idx, unsigned char component_value);
 
 
-    /**
-     * @brief Inverts the colors of the image
-     * 
-     */
-    void inverseColors();
-
-
-    /**
-     * @brief Converts the image to black and white
-     * 
-     */
-    void grayColors();
-
-
-    /**
-     * @brief Fill area with color
-     * 
-     * @param[in] x the X coordinate of the beginning of the fill
-     * @param[in] y the Y coordinate of the beginning of the fill
-     * @param[in] color fill color
-     */
-    void floodFill(int x, int y, ColorBGR color);
-
-
 private:
 
     #pragma pack(push, 1)
@@ -350,9 +236,6 @@ private:
 
     BMPHeader            bmp_header_;
     DIBHeader            dib_header_;
-    int                  width_;
-    int                  height_;
-    ColorBGR             **bitmap_;
     
     /**
      * @brief Check if the image file matches the BMP format
@@ -362,139 +245,39 @@ private:
      */
     bool checkFileValidity();
 
-
-    /**
-     * @brief Allocate memmory for image data (width_ * height_)
-     * 
-     */
-    void allocateMemmoryForBitmap();
-
-
-    /**
-     * @brief Free memmory for image data
-     * 
-     */
-    void freeMemmoryForBitmap();
-
-
-    /**
-     * @brief Check if coordinate belongs to the image
-     * 
-     * @param[in] x the X coordinate of the pixel
-     * @param[in] y the Y coordinate of the pixel
-     * @return true - coordinate belongs to the image
-     * @return false - coordinate does not belong to the image
-     */
-    bool checkCoordsValidity(int x, int y);
-    
-
-    /**
-     * @brief Draw Bresenham line low<br>
-     * (line with thickness 1 and slope < 1)<br>
-     * (method used by DrawBresenhamLine)
-     * 
-     * @param[in] x0 X coordinate of the beginning of the line
-     * @param[in] y0 Y coordinate of the beginning of the line
-     * @param[in] x1 X coordinate of the end of the line
-     * @param[in] y1 Y coordinate of the end of the line
-     * @param[in] color line color
-     */
-    void drawBresenhamLineLow(int x0, int y0, int x1, int y1, ColorBGR color);
-
-
-    /**
-     * @brief Draw Bresenham line high<br>
-     * (line with thickness 1 and slope > 1)<br>
-     * (method used by DrawBresenhamLine)
-     * 
-     * @param[in] x0 X coordinate of the beginning of the line
-     * @param[in] y0 Y coordinate of the beginning of the line
-     * @param[in] x1 X coordinate of the end of the line
-     * @param[in] y1 Y coordinate of the end of the line
-     * @param[in] color line color
-     */
-    void drawBresenhamLineHigh(int x0, int y0, int x1, int y1, ColorBGR color);
-
-
-    /**
-     * @brief Draw line high<br>
-     * (line with thickness 1 and slope < 1)<br>
-     * (method used by DrawLine)
-     * 
-     * @param[in] x0 X coordinate of the beginning of the line
-     * @param[in] y0 Y coordinate of the beginning of the line
-     * @param[in] x1 X coordinate of the end of the line
-     * @param[in] y1 Y coordinate of the end of the line
-     * @param[in] color line color
-     */
-    void drawLineHigh(int x0, int y0, int x1, int y1, 
-        int thickness, ColorBGR color);
-
-
-    /**
-     * @brief Draw line high<br>
-     * (line with thickness 1 and slope > 1)<br>
-     * (method used by DrawLine)
-     * 
-     * @param[in] x0 X coordinate of the beginning of the line
-     * @param[in] y0 Y coordinate of the beginning of the line
-     * @param[in] x1 X coordinate of the end of the line
-     * @param[in] y1 Y coordinate of the end of the line
-     * @param[in] color line color
-     */
-    void drawLineLow(int x0, int y0, int x1, int y1, 
-        int thickness, ColorBGR color);
-
-
     /**
-     * @brief check if point is on the circle line
+     * @brief Read every scale-th pixel of every scale-th row of the area from a BMP file<br>
+     * (the area is clipped to the image)
      * 
-     * @param x[in] the X coordinate of the point being checked
-     * @param y[in] the Y coordinate of the the point being checked
-     * @param x0[in] the X coordinate of the circle center
-     * @param y0[in] the Y coordinate of the circle center
-     * @param radius[in] circle radius
-     * @param thickness[in] thickness of outline
-     * @return true - if point on circle line
-     * @return false - if point is not on circle line
+     * @param[in] input_file_name input file name
+     * @param[in] scale reduction (1, 2, 4 or 8)
+     * @param[in] x0 the X coordinate of upper left corner of the area
+     * @param[in] y0 the Y coordinate of upper left corner of the area
+     * @param[in] x1 the X coordinate of lower right corner of the area
+     * @param[in] y1 the Y coordinate of lower right corner of the area
      */
-    bool checkOnCircleLine(int x, int y, int x0, int y0, int radius, int thickness);
-    
+    void readPartialImageFromFile(const char *input_file_name, int scale, int x0, int y0, int x1, int y1);
 
     /**
-     * @brief check if point is in the circle
+     * @brief Set the size and the row order of the image from dib_header_
      * 
-     * @param x[in] the X coordinate of the point being checked
-     * @param y[in] the Y coordinate of the the point being checked
-     * @param x0[in] the X coordinate of the circle center
-     * @param y0[in] the Y coordinate of the circle center
-     * @param radius[in] circle radius
-     * @param thickness[in] thickness of outline
-     * @return true - if point is in the circle
-     * @return false - if point is not in the circle
      */
-    bool checkInCircle(int x, int y, int x0, int y0, int radius, int thickness);
-        
+    void readInfoFields();
 
     /**
-     * @brief the function gets the intersection points of y = const and polygon
+     * @brief Make the pixel data be read from the file on the first access<br>
+     * (the headers must be read already)
      * 
-     * @param[out] intersections a vector that stores the intersections of the line y = const with the sides of the polygon
-     * @param[in] y const
-     * @param[in] vertices vertices of the polygon
+     * @param[in] input_file_name input file name
      */
-    void getPolygonIntersections(std::vector<std::pair<int, int>>& intersections, 
-        int y, std::vector<ie::Coord>& vertices);
-    
+    void deferReading(const char *input_file_name);
 
     /**
-     * @brief Fill pilygon<br>
-     * (used by DrawPolygon)
+     * @brief Fill bmp_header_ and dib_header_ for the current size and row order<br>
+     * (the pixel array follows the headers, rows are padded to stride_ bytes)
      * 
-     * @param[in] vertices the vector of polygon coordinates in the order of their connection
-     * @param[in] fill_color polygon fill color
      */
-    void fillPolygon(std::vector<Coord>& vertices, ColorBGR& fill_color);
+    void updateHeaders();
 };
 
 }
@@ -15,6 +15,7 @@
 #include "Structures.h"
 #include "ImagePNG.h"
 #include "ImageBMP.h"
+#include "BatchDecoder.h"
 
 
 #endif
\ No newline at end of file
@@ -12,17 +12,29 @@
 #define IMAGE_PNG_H
 
 #include "Structures.h"
+#include "Image.h"
+#include "PNGCodecContext.h"
 #include <png.h>
+#include <zlib.h>
 #include <vector>
+#include <stdint.h>
+#include <functional>
 
 #define PNG_SIG_BYTES                 8
+#define PNG_PROBE_BYTES               33
 
-#define PNG_TURN_180                  0
-#define PNG_TURN_90_CLOCKWISE         1
-#define PNG_TURN_90_COUNTERCLOCKWISE  2
+#define PNG_READ_DECODE               0
+#define PNG_READ_LAZY                 1
 
-#define PNG_VERTICAL                  0
-#define PNG_HORIZONTAL                1
+#define PNG_PARALLEL_BLOCK_SIZE       (1 << 20)
+#define PNG_DEFLATE_WINDOW            32768
+
+#define PNG_TURN_180                  IMAGE_TURN_180
+#define PNG_TURN_90_CLOCKWISE         IMAGE_TURN_90_CLOCKWISE
+#define PNG_TURN_90_COUNTERCLOCKWISE  IMAGE_TURN_90_COUNTERCLOCKWISE
+
+#define PNG_VERTICAL                  IMAGE_VERTICAL
+#define PNG_HORIZONTAL                IMAGE_HORIZONTAL
 
 /**
  * @brief namespace of ImageEditor.h
@@ -31,265 +43,294 @@
 namespace ie
 {
 
-
 /**
- * @brief Class for working with PNG files
+ * @brief Structure for representing PNG encoder settings<br>
+ * (the default values are the libpng defaults)
  * 
  */
-class ImagePNG
+struct PNGEncodeOptions
 {
-public:
+    int     compression_level = 6;                  // zlib level [0..9]
+    int     strategy          = Z_FILTERED;         // Z_DEFAULT_STRATEGY, Z_FILTERED, Z_HUFFMAN_ONLY, Z_RLE or Z_FIXED
+    int     filters           = PNG_ALL_FILTERS;    // PNG_FILTER_* flags, the best of them is chosen for each row
+    size_t  buffer_size       = 8192;               // zlib output buffer size in bytes
+    int     threads           = 1;                  // encoding threads (0 - one per core, 1 - libpng encoder)
+    bool    auto_color_type   = false;              // write the smallest color type holding all colors
 
     /**
-     * @brief Construct a new ImagePNG object
+     * @brief Settings for the shortest encoding time<br>
+     * (the file is noticeably larger)
      * 
+     * @return PNGEncodeOptions - settings
      */
-    ImagePNG();
+    static PNGEncodeOptions fastest()
+    {
+        return {1, Z_RLE, PNG_FILTER_SUB, 1 << 16};
+    }
 
 
     /**
-     * @brief Destroy the ImagePNG object
+     * @brief Settings with several times faster encoding than the default 
+     * and a few percent larger file
      * 
+     * @return PNGEncodeOptions - settings
      */
-    ~ImagePNG();
+    static PNGEncodeOptions balanced()
+    {
+        return {3, Z_FILTERED, PNG_FAST_FILTERS, 1 << 16};
+    }
 
 
     /**
-    * @brief Displaying basic information about a PNG object in the out stream
-    * (it may not be appropriate if the image was read from a file, because it 
-    * is being converted to 8-bit/color RGBA)
-    * 
-    * @param[in] input_file_name input file name
-    */
-    void showInfo();
+     * @brief Settings for the smallest file<br>
+     * (the slowest encoding, the color type is minimized)
+     * 
+     * @return PNGEncodeOptions - settings
+     */
+    static PNGEncodeOptions smallest()
+    {
+        return {9, Z_FILTERED, PNG_ALL_FILTERS, 1 << 20, 1, true};
+    }
+};
+
+
+
+/**
+ * @brief Class for working with PNG files<br>
+ * (image processing methods are implemented by Image)<br>
+ * (images read from files keep their pixel format: gray, gray with alpha, RGB, palette 
+ * or RGBA, with 8 bits per component; the methods below work on these formats directly 
+ * and convert the image to RGBA only when the result can not be stored in its format)<br>
+ * (Image is a protected base: its methods expect RGBA pixel data, so an ImagePNG 
+ * can not be used as an Image<PixelRGBA>)
+ * 
+ */
+class ImagePNG : protected Image<PixelRGBA>
+{
+public:
 
+    using Image::Color;
+    using Image::getWidth;
+    using Image::getHeight;
+    using Image::getDataSize;
 
     /**
-     * @brief Get the Width object
+     * @brief Function called by processFile for every row<br>
+     * (row - view of one row, y - the Y coordinate of the row in the image)
      * 
-     * @return int - image width
      */
-    int getWidth();
-    
+    typedef std::function<void(ImageView<PixelRGBA> row, int y)> RowCallback;
+
 
     /**
-     * @brief Get the Height image
+     * @brief Construct a new ImagePNG object
      * 
-     * @return int - image height
      */
-    int getHeight();
+    ImagePNG();
 
 
     /**
-     * @brief Get the pixel ColorRGBA 
-     * 
-     * @param[in] x the X coordinate of the pixel
-     * @param[in] y the Y coordinate of the pixel
-     * @return ColorRGBA - pixel color
-     */
-    ColorRGBA getColor(int x, int y);
+    * @brief Displaying basic information about a PNG object in the out stream
+    * (16-bit images are read as 8-bit/color)
+    * 
+    */
+    void showInfo();
 
 
     /**
-     * @brief Set the ColorRGBA object
+     * @brief Get the size of a pixel in memmory
      * 
-     * @param[in] x the X coordinate of the pixel
-     * @param[in] y the Y coordinate of the pixel
-     * @param[in] color pixel color
+     * @return int - bytes per pixel (1 - gray or palette, 2 - gray with alpha, 3 - RGB, 4 - RGBA)
      */
-    void setColor(int x, int y, ColorRGBA color);
+    int getPixelSize();
 
 
     /**
-     * @brief Set the Size image<br>
-     * (sets the color value for all pixels {0, 0, 0, 0})
+     * @brief Get the pixel format
      * 
-     * @param[in] width image wigth
-     * @param[in] height image height
+     * @return int - PNG color type (PNG_COLOR_TYPE_GRAY, PNG_COLOR_TYPE_GRAY_ALPHA, 
+     * PNG_COLOR_TYPE_RGB, PNG_COLOR_TYPE_PALETTE or PNG_COLOR_TYPE_RGBA)
      */
-    void setSize(int width, int height);
+    int getColorType();
 
 
     /**
-     * @brief Read an image from a PNG file<br>
-     * (converts images to 8-bit/color RGBA when reading)
+     * @brief Convert the image to the 8-bit/color RGBA pixel format<br>
+     * (the colors do not change; needed before working with views of the image data)
      * 
-     * @param[in] input_file_name input file name
      */
-    void readImageFromFile(const char *input_file_name);
+    void convertToRGBA();
 
 
     /**
-     * @brief Write an image to a PNG file<br>
-     * (outputs image as 8-bit/color RGBA)
+     * @brief Convert the image to the smallest pixel format holding all its colors<br>
+     * (one pass over the image finds transparency, gray colors and up to 256 different colors; 
+     * the format is gray, palette, gray with alpha, RGB or RGBA in this order of preference)
      * 
-     * @param[in] output_file_name output file name
+     * @return true - if the pixel format was changed
+     * @return false - if the image already has the smallest pixel format 
+     * (a palette image also has to have the palette of its colors with the transparent ones first)
      */
-    void writeImageToFile(const char *output_file_name);
+    bool minimizePixelFormat();
+
 
     /**
-     * @brief Clear the image<br>
-     * (sets the color value for all pixels {0, 0, 0, 0})
+     * @brief Convert the image to a one-channel gray pixel format<br>
+     * (RGBA images and palette images with transparent colors keep the alpha 
+     * and become gray with alpha; gray images do not change)
      * 
+     * @param[in] method gray method (format can be: GRAY_BT601, GRAY_BT709, GRAY_AVERAGE or GRAY_LIGHTNESS)
      */
-    void clear();
+    void convertToGray(int method = GRAY_BT601);
 
 
     /**
-     * @brief Resize the image and insert the original one at the position x0, y0 for the upper-left corner)
+     * @brief Read an image from a PNG file<br>
+     * (keeps the pixel format of the file with 8 bits per component)
      * 
-     * @param[in] x0 the X coordinate of the upper-left corner of the original image insertion
-     * @param[in] y0 the Y coordinate of the upper-left corner of the original image insertion
-     * @param[in] new_width new image width
-     * @param[in] new_height new image height
+     * @param[in] input_file_name input file name
+     * @param[in] read_mode when the pixel data is decoded (format can be:<br>
+     * PNG_READ_DECODE - now,<br>
+     * PNG_READ_LAZY - only the chunks before the image data are read now, the pixel data is 
+     * decoded on the first access; the file must not be changed until then, 
+     * writeImageToFile decodes it first, so the image can be written back to the same file)
      */
-    void resize(int x0, int y0, int new_width, int new_height);
-    
+    void readImageFromFile(const char *input_file_name, int read_mode = PNG_READ_DECODE);
+
 
     /**
-     * @brief Return a new object of the ImagePNG class, which is part of the image
+     * @brief Read a reduced copy of the image from a PNG file<br>
+     * (every scale-th pixel of every scale-th row is kept, the size is rounded up; 
+     * interlaced files are read only up to the Adam7 pass that contains these pixels, 
+     * other files are reduced row by row, so the full-size image is never allocated)
      * 
-     * @param[in] x0 the X coordinate of upper left corner of the copy area
-     * @param[in] y0 the Y coordinate of upper left corner of the copy area
-     * @param[in] x1 the X coordinate of lower right corner of the copy area
-     * @param[in] y1 the Y coordinate of lower right corner of the copy area
-     * @return ImagePNG - copied area
+     * @param[in] input_file_name input file name
+     * @param[in] scale reduction (format can be: 1, 2, 4 or 8)
      */
-    ImagePNG copy(int x0, int y0, int x1, int y1);
-    
+    void readScaledImageFromFile(const char *input_file_name, int scale);
+
 
     /**
-     * @brief Insert an image at the position x0, y0 for the upper-left corner
+     * @brief Read a part of the image from a PNG file<br>
+     * (the area is clipped to the image; the rows are decoded in order and only the area is kept, 
+     * decoding stops after the last row of the area, so the memmory depends only on the area size)
      * 
-     * @param[in] src_image image to copy
-     * @param[in] x0 the X coordinate of upper left corner of insertion
-     * @param[in] y0 the Y coordinate of upper left corner of insertion
+     * @param[in] input_file_name input file name
+     * @param[in] x0 the X coordinate of upper left corner of the area
+     * @param[in] y0 the Y coordinate of upper left corner of the area
+     * @param[in] x1 the X coordinate of lower right corner of the area
+     * @param[in] y1 the Y coordinate of lower right corner of the area
      */
-    void paste(ImagePNG& src_image, int x0, int y0);
+    void readAreaFromFile(const char *input_file_name, int x0, int y0, int x1, int y1);
+
 
-    
     /**
-     * @brief Rotate the image at angles multiple of 90
+     * @brief Read the size and format of a PNG file without decoding the image<br>
+     * (only the signature and the IHDR chunk are read)
      * 
-     * @param[in] rotation_type type of rotation (TURN_180, TURN_90_CLOCKWISE or TURN_90_COUNTERCLOCKWISE)
+     * @param[in] input_file_name input file name
+     * @param[out] info image metadata (as stored in the file)
+     * @return true - if the file is a PNG file with a valid IHDR chunk
+     * @return false - if the file could not be opened or has another format
      */
-    void rotate(int rotation_type);
+    static bool probeFile(const char *input_file_name, ImageInfo& info);
 
 
     /**
-     * @brief Reflect the image
+     * @brief Read the size and format of PNG data in memmory without decoding the image<br>
+     * (only the signature and the IHDR chunk are read)
      * 
-     * @param[in] reflection_type type of reflection (format can be: VERTICAL or HORIZONTAL)
+     * @param[in] data PNG file data (at least PNG_PROBE_BYTES bytes)
+     * @param[in] size data size in bytes
+     * @param[out] info image metadata (as stored in the file)
+     * @return true - if the data is a PNG file with a valid IHDR chunk
+     * @return false - if the data has another format
      */
-    void reflect(int reflection_type);
+    static bool probeMemory(const void *data, size_t size, ImageInfo& info);
+
 
-    
     /**
-     * @brief Draw Bresenham line<br>
-     * (line with thickness 1)
+     * @brief Read an image from PNG data in memmory<br>
+     * (keeps the pixel format of the file with 8 bits per component)
      * 
-     * @param[in] x0 the X coordinate of the beginning of the line
-     * @param[in] y0 the Y coordinate of the beginning of the line
-     * @param[in] x1 the X coordinate of the end of the line
-     * @param[in] y1 the Y coordinate of the end of the line
-     * @param[in] color line color
+     * @param[in] data PNG file data
+     * @param[in] size data size in bytes
      */
-    void drawBresenhamLine(int x0, int y0, int x1, int y1, ColorRGBA color);
+    void readImageFromMemory(const void *data, size_t size);
 
 
     /**
-     * @brief Draw Bresenham line<br>
-     * (line with any thickness)<br>
-     * (thickness is set by drawing parallel lines by the Bresenham algorithm)
+     * @brief Write an image to a PNG file<br>
+     * (outputs image in its pixel format with 8 bits per component)
      * 
-     * @param[in] x0 the X coordinate of the beginning of the line
-     * @param[in] y0 the Y coordinate of the beginning of the line
-     * @param[in] x1 the X coordinate of the end of the line
-     * @param[in] y1 the Y coordinate of the end of the line
-     * @param[in] color line color
+     * @param[in] output_file_name output file name
      */
-    void drawMurphyLine(int x0, int y0, int x1, int y1, 
-        int thickness, ColorRGBA color);
+    void writeImageToFile(const char *output_file_name);
 
 
     /**
-     * @brief Draw line<br>
-     * (line with any thickness)<br>
-     * (thickness is set by drawing circles at each point of the line)
+     * @brief Write an image as PNG data to memmory<br>
+     * (outputs image in its pixel format with 8 bits per component)
      * 
-     * @param[in] x0 the X coordinate of the beginning of the line
-     * @param[in] y0 the Y coordinate of the beginning of the line
-     * @param[in] x1 the X coordinate of the end of the line
-     * @param[in] y1 the Y coordinate of the end of the line
-     * @param[in] thickness thickenss of the line
-     * @param[in] color line color
+     * @param[out] output_buffer PNG file data (the previous content is replaced)
      */
-    void drawLine(int x0, int y0, int x1, int y1, 
-        int thickness, ColorRGBA color);
+    void writeImageToBuffer(std::vector<uint8_t>& output_buffer);
 
 
     /**
-     * @brief Draw Bresenham circle<br>
-     * (circle with thickness 1)
+     * @brief Process a PNG file row by row and write the result to another PNG file<br>
+     * (each row is decoded, changed by all the operations in order and encoded 
+     * before the next row is decoded, so only one row is kept in memmory)<br>
+     * (the output is 8-bit/color RGBA; interlaced files can not be decoded by rows, 
+     * they are read whole and processed the same way)
      * 
-     * @param[in] x0 the X coordinate of the center of the circle
-     * @param[in] y0 the X coordinate of the center of the circle
-     * @param[in] radius circle radius
-     * @param[in] color circle color
+     * @param[in] input_file_name input file name
+     * @param[in] output_file_name output file name (must differ from the input file)
+     * @param[in] operations functions that change each row, in the order of calling
+     * @param[in] options encoder settings (auto_color_type and threads are ignored, 
+     * the rows are encoded by libpng one by one)
      */
-    void drawBresenhamCircle(int x0, int y0, int radius, ColorRGBA color);
+    static void processFile(const char *input_file_name, const char *output_file_name, 
+                            const std::vector<RowCallback>& operations, 
+                            const PNGEncodeOptions& options = PNGEncodeOptions());
 
 
     /**
-     * @brief Draw circle<br>
-     * (circle with any thickness)
+     * @brief Set the encoder settings used by writeImageToFile and writeImageToBuffer
      * 
-     * @param[in] x0 the X coordinate of the center of the circle
-     * @param[in] y0 the X coordinate of the center of the circle
-     * @param[in] radius circle radius
-     * @param[in] thickness circle thickness
-     * @param[in] color circle color
-     * @param[in] fill should it be filled in (format can be: true or false)
-     * @param[in] fill_color circle fill color
+     * @param[in] options encoder settings (PNGEncodeOptions::fastest(), balanced(), smallest() or custom)
      */
-    void drawCircle(int x0, int y0, int radius, int thickness, 
-        ColorRGBA color, bool fill, ColorRGBA fill_color);
+    void setEncodeOptions(const PNGEncodeOptions& options);
 
 
     /**
-     * @brief Draw polygon<br>
-     * (polygon with any thickness)<br>
-     * (used alg: scan line)
+     * @brief Get the encoder settings
      * 
-     * @param[in] vertices the vector of polygon coordinates in the order of their connection
-     * @param[in] thickness polygon thickness
-     * @param[in] color polygon color
-     * @param[in] fill should it be filled in (true or false)
-     * @param[in] fill_color polygon fill color
+     * @return PNGEncodeOptions - encoder settings
      */
-    void drawPolygon(std::vector<Coord> vertices, int thickness, 
-        ColorRGBA color, bool fill, ColorRGBA fill_color);
+    PNGEncodeOptions getEncodeOptions();
 
 
     /**
-     * @brief Check if point is in polygon
+     * @brief Set the context giving memmory to libpng for reading and writing files<br>
+     * (the context must exist while the image reads or writes and must not be used 
+     * by another thread at the same time; copies of the image use the same context)
      * 
-     * @param[in] x the X coordinate of point
-     * @param[in] y the X coordinate of point
-     * @param[in] vertices the vector of polygon coordinates in the order of their connection
-     * @return true - point is in the polygon
-     * @return false - point is not in the polygon
+     * @param[in] context codec context (NULL - libpng allocates memmory with malloc)
      */
-    bool inPolygon(int x, int y, std::vector<Coord>& vertices);
-    
+    void setCodecContext(PNGCodecContext *context);
+
 
     /**
-     * @brief Replace a certain color with a new one
+     * @brief Return a new object of the ImagePNG class, which is part of the image
      * 
-     * @param[in] old_color old color (foramat: {R, G, B, A})
-     * @param[in] new_color new color (format: {R, G, B, A})
+     * @param[in] x0 the X coordinate of upper left corner of the copy area
+     * @param[in] y0 the Y coordinate of upper left corner of the copy area
+     * @param[in] x1 the X coordinate of lower right corner of the copy area
+     * @param[in] y1 the Y coordinate of lower right corner of the copy area
+     * @return ImagePNG - copied area
      */
-    void colorReplace(ColorRGBA old_color, ColorRGBA new_color);
+    ImagePNG copy(int x0, int y0, int x1, int y1);
 
 
     /**
@@ -301,44 +342,114 @@ public:
     void rgbaFilter(int component_idx, unsigned char component_value);
 
 
+    /*
+     * The methods of Image working with any pixel format of ImagePNG
+     * (see the descriptions in Image.h)
+     */
+
+    Color getColor(int x, int y);
+    void setColor(int x, int y, Color color);
+    void setSize(int width, int height);
+    void clear();
+    void resize(int x0, int y0, int new_width, int new_height);
+    void paste(ImagePNG& src_image, int x0, int y0);
+    void paste(ImageView<PixelRGBA> src_view, int x0, int y0);
+    void copyFrom(ImageView<PixelRGBA> src_view);
+    void rotate(int rotation_type);
+    void reflect(int reflection_type);
+    void drawBresenhamLine(int x0, int y0, int x1, int y1, Color color);
+    void drawMurphyLine(int x0, int y0, int x1, int y1, int thickness, Color color);
+    void drawLine(int x0, int y0, int x1, int y1, int thickness, Color color);
+    void drawBresenhamCircle(int x0, int y0, int radius, Color color);
+    void drawCircle(int x0, int y0, int radius, int thickness, Color color, bool fill, Color fill_color);
+    void drawPolygon(std::vector<Coord> vertices, int thickness, Color color, bool fill, Color fill_color);
+    bool inPolygon(int x, int y, std::vector<Coord>& vertices);
+    void colorReplace(Color old_color, Color new_color);
+    void componentFilter(int component_idx, unsigned char component_value);
+    void inverseColors();
+    void grayColors(int method = GRAY_BT601);
+    void floodFill(int x, int y, Color color);
+
+
+    /*
+     * Views of the image data are RGBA, so the image is converted to RGBA first
+     */
+
+    ImageView<PixelRGBA> view();
+    ImageView<PixelRGBA> view(int x0, int y0, int x1, int y1);
+    ImageView<PixelRGBA> constView();
+    ImageView<PixelRGBA> constView(int x0, int y0, int x1, int y1);
+
+
     /**
-     * @brief Inverts the colors of the image
+     * @brief Call the function for every row of the image<br>
+     * (the rows are RGBA, so the image is converted to RGBA first; see ImageView::forEachRow)
      * 
+     * @param[in] policy execution policy (execution::seq, execution::par or execution::par_unseq)
+     * @param[in] function function taking the Y coordinate and the PixelSpan<PixelRGBA> of the row
      */
-    void inverseColors();
+    template <class ExecutionPolicy, class Function>
+    void forEachRow(ExecutionPolicy policy, Function function)
+    {
+        view().forEachRow(policy, function);
+    }
 
 
     /**
-     * @brief Converts the image to black and white
+     * @brief Call the function for every pixel of the image without changing it<br>
+     * (works on any pixel format; see ImageView::forEachPixel)
      * 
+     * @param[in] policy execution policy (execution::seq, execution::par or execution::par_unseq)
+     * @param[in] function function taking the X and Y coordinates and the color of the pixel
      */
-    void grayColors();
+    template <class ExecutionPolicy, class Function>
+    void forEachPixel(ExecutionPolicy policy, Function function)
+    {
+        forNativeView(false, [&](auto view) {
+            view.forEachPixel(policy, [&](int x, int y, Color native_color) {
+                function(x, y, fromNativeColor(native_color));
+            });
+        });
+    }
 
 
     /**
-     * @brief Fill area with color
+     * @brief Replace the color of every pixel with the result of the function<br>
+     * (palette images change the palette colors, other images are converted to RGBA first; 
+     * see ImageView::transformPixels)
      * 
-     * @param[in] x the X coordinate of the beginning of the fill
-     * @param[in] y the Y coordinate of the beginning of the fill
-     * @param[in] color fill color
+     * @param[in] policy execution policy (execution::seq, execution::par or execution::par_unseq)
+     * @param[in] function function taking the color of the pixel and returning the new color
      */
-    void floodFill(int x, int y, ColorRGBA color);
+    template <class ExecutionPolicy, class Function>
+    void transformPixels(ExecutionPolicy policy, Function function)
+    {
+        if (color_type_ == PNG_COLOR_TYPE_PALETTE) {
+            for (ColorRGBA& color : palette_) {
+                color = function(color);
+            }
+            return;
+        }
+        view().transformPixels(policy, function);
+    }
 
 
 private:
-    const int     pixel_size_;
     png_structp   png_ptr_;
     png_infop     info_ptr_;
     png_infop     end_info_ptr_;
-    int           width_;
-    int           height_;
     png_byte      bit_depth_;
     png_byte      color_type_;
     png_byte      interlace_type_;
     png_byte      compression_type_;
     png_byte      filter_type_;
     int           number_of_passes_;
-    png_bytepp    row_pointers_;
+    int           pixel_size_;
+
+    std::vector<ColorRGBA>  palette_;
+
+    PNGEncodeOptions  encode_options_;
+    PNGCodecContext  *codec_context_;
 
     
     /**
@@ -350,152 +461,252 @@ private:
      */
     bool checkFileValidity(FILE *input_file);
     
+
     /**
-     * @brief Allocate memmory for image data (width_ * height_)
+     * @brief Create an array of pointers to the image rows for libpng<br>
+     * (the array should be freed with free)
      * 
+     * @return png_bytepp - row pointers
      */
-    void allocateMemmoryForRowPointers();
+    png_bytepp createRowPointers();
 
 
     /**
-     * @brief Free memmory for image data
+     * @brief Create the read structures png_ptr_, info_ptr_ and end_info_ptr_
      * 
+     * @return const char* - error message or NULL if the structures are created
      */
-    void freeMemmoryForRowPointers();
-    
+    const char* createReadStructs();
+
 
     /**
-     * @brief Reads info structure
+     * @brief Read the chunks before the image data from png_ptr_ with the input already set 
+     * and set the format fields and the input transformations<br>
+     * (the signature must be already read; the read structures are destroyed on error)
      * 
+     * @return const char* - error message or NULL if the header is read
      */
-    void readInfoFields();
+    const char* decodeHeader();
 
 
     /**
-     * @brief Converts image to 8-bit/color RGBA
+     * @brief Decode the image rows after decodeHeader<br>
+     * (the read structures are destroyed)
      * 
+     * @param[out] data stride_ * height_ bytes for the rows
+     * @return const char* - error message or NULL if the rows are decoded
      */
-    void transformInput();
+    const char* decodeRows(unsigned char *data);
 
 
     /**
-     * @brief Check if coordinate belongs to the image
+     * @brief Make the pixel data be decoded from the file on the first access<br>
+     * (decodeHeader must be called already)
      * 
-     * @param[in] x the X coordinate of the pixel
-     * @param[in] y the Y coordinate of the pixel
-     * @return true - coordinate belongs to the image
-     * @return false - coordinate does not belong to the image
+     * @param[in] input_file_name input file name
      */
-    bool checkCoordsValidity(int x, int y);
-    
+    void deferDecoding(const char *input_file_name);
+
 
     /**
-     * @brief Draw Bresenham line low<br>
-     * (line with thickness 1 and slope < 1)<br>
-     * (method used by DrawBresenhamLine)
+     * @brief Decode the file read by deferDecoding into the deferred block<br>
+     * (the file must have the same size and pixel format)
      * 
-     * @param[in] x0 X coordinate of the beginning of the line
-     * @param[in] y0 Y coordinate of the beginning of the line
-     * @param[in] x1 X coordinate of the end of the line
-     * @param[in] y1 Y coordinate of the end of the line
-     * @param[in] color line color
+     * @param[in] input_file_name input file name
+     * @param[out] data block for the rows
+     * @param[in] size size of the block in bytes
      */
-    void drawBresenhamLineLow(int x0, int y0, int x1, int y1, ColorRGBA color);
+    void decodeDeferred(const char *input_file_name, unsigned char *data, size_t size);
 
 
     /**
-     * @brief Draw Bresenham line high<br>
-     * (line with thickness 1 and slope > 1)<br>
-     * (method used by DrawBresenhamLine)
+     * @brief Decode the image from png_ptr_ with the input already set<br>
+     * (the signature must be already read, the read structures are destroyed)
      * 
-     * @param[in] x0 X coordinate of the beginning of the line
-     * @param[in] y0 Y coordinate of the beginning of the line
-     * @param[in] x1 X coordinate of the end of the line
-     * @param[in] y1 Y coordinate of the end of the line
-     * @param[in] color line color
+     * @return const char* - error message or NULL if the image is decoded
      */
-    void drawBresenhamLineHigh(int x0, int y0, int x1, int y1, ColorRGBA color);
+    const char* decodeImage();
 
 
     /**
-     * @brief Draw line high<br>
-     * (line with thickness 1 and slope < 1)<br>
-     * (method used by DrawLine)
+     * @brief Decode every scale-th pixel of every scale-th row of the area from png_ptr_ 
+     * with the input already set<br>
+     * (the signature must be already read, the read structures are destroyed; 
+     * the area is clipped to the image, rows after the area are not decoded)
      * 
-     * @param[in] x0 X coordinate of the beginning of the line
-     * @param[in] y0 Y coordinate of the beginning of the line
-     * @param[in] x1 X coordinate of the end of the line
-     * @param[in] y1 Y coordinate of the end of the line
-     * @param[in] color line color
+     * @param[in] scale reduction (1, 2, 4 or 8)
+     * @param[in] x0 the X coordinate of upper left corner of the area
+     * @param[in] y0 the Y coordinate of upper left corner of the area
+     * @param[in] x1 the X coordinate of lower right corner of the area
+     * @param[in] y1 the Y coordinate of lower right corner of the area
+     * @return const char* - error message or NULL if the image is decoded
      */
-    void drawLineHigh(int x0, int y0, int x1, int y1, 
-        int thickness, ColorRGBA color);
+    const char* decodePartialImage(int scale, int x0, int y0, int x1, int y1);
 
 
     /**
-     * @brief Draw line high<br>
-     * (line with thickness 1 and slope > 1)<br>
-     * (method used by DrawLine)
+     * @brief Read every scale-th pixel of every scale-th row of the area from a PNG file
      * 
-     * @param[in] x0 X coordinate of the beginning of the line
-     * @param[in] y0 Y coordinate of the beginning of the line
-     * @param[in] x1 X coordinate of the end of the line
-     * @param[in] y1 Y coordinate of the end of the line
-     * @param[in] color line color
+     * @param[in] input_file_name input file name
+     * @param[in] scale reduction (1, 2, 4 or 8)
+     * @param[in] x0 the X coordinate of upper left corner of the area
+     * @param[in] y0 the Y coordinate of upper left corner of the area
+     * @param[in] x1 the X coordinate of lower right corner of the area
+     * @param[in] y1 the Y coordinate of lower right corner of the area
      */
-    void drawLineLow(int x0, int y0, int x1, int y1, 
-        int thickness, ColorRGBA color);
-    
+    void readPartialImageFromFile(const char *input_file_name, int scale, int x0, int y0, int x1, int y1);
+
 
     /**
-     * @brief check if point is on the circle line
+     * @brief Create the write structures png_ptr_ and info_ptr_
      * 
-     * @param x[in] the X coordinate of the point being checked
-     * @param y[in] the Y coordinate of the the point being checked
-     * @param x0[in] the X coordinate of the circle center
-     * @param y0[in] the Y coordinate of the circle center
-     * @param radius[in] circle radius
-     * @param thickness[in] thickness of outline
-     * @return true - if point on circle line
-     * @return false - if point is not on circle line
+     * @return const char* - error message or NULL if the structures are created
      */
-    bool checkOnCircleLine(int x, int y, int x0, int y0, int radius, int thickness);
-    
+    const char* createWriteStructs();
+
 
     /**
-     * @brief check if point is in the circle
+     * @brief Encode the image to png_ptr_ with the output already set<br>
+     * (the write structures are destroyed)
      * 
-     * @param x[in] the X coordinate of the point being checked
-     * @param y[in] the Y coordinate of the the point being checked
-     * @param x0[in] the X coordinate of the circle center
-     * @param y0[in] the Y coordinate of the circle center
-     * @param radius[in] circle radius
-     * @param thickness[in] thickness of outline
-     * @return true - if point is in the circle
-     * @return false - if point is not in the circle
+     * @return const char* - error message or NULL if the image is encoded
      */
-    bool checkInCircle(int x, int y, int x0, int y0, int radius, int thickness);
+    const char* encodeImage();
+
+
+    /**
+     * @brief Check if the image is encoded by encodeImageParallel<br>
+     * (more than one thread is set, the image is not empty and not interlaced)
+     * 
+     * @return true - if the parallel encoder is used
+     * @return false - if libpng encodes the image
+     */
+    bool useParallelEncoder();
+
+
+    /**
+     * @brief Encode the image on encode_options_.threads threads<br>
+     * (blocks of PNG_PARALLEL_BLOCK_SIZE bytes of rows are filtered and deflated independently, 
+     * each with the previous PNG_DEFLATE_WINDOW bytes as the dictionary, and joined with 
+     * sync-flush boundaries and the combined Adler-32 into one IDAT stream)
+     * 
+     * @param[out] output_buffer PNG file data
+     * @return const char* - error message or NULL if the image is encoded
+     */
+    const char* encodeImageParallel(std::vector<uint8_t>& output_buffer);
+
+
+    /**
+     * @brief Pass the encoder settings to the write structure
+     * 
+     * @param[in] png_ptr write structure
+     * @param[in] options encoder settings
+     */
+    static void applyEncodeOptions(png_structp png_ptr, const PNGEncodeOptions& options);
+
 
-    
     /**
-     * @brief the function gets the intersection points of y = const and polygon
+     * @brief Set color_type_ and pixel_size_ for an 8-bit pixel format
      * 
-     * @param[out] intersections a vector that stores the intersections of the line y = const with the sides of the polygon
-     * @param[in] y const
-     * @param[in] vertices vertices of the polygon
+     * @param[in] color_type PNG color type
      */
-    void getPolygonIntersections(std::vector<std::pair<int, int>>& intersections, 
-        int y, std::vector<ie::Coord>& vertices);
+    void setPixelFormat(int color_type);
+
+
+    /**
+     * @brief Get the size of a stored row in the pixel format of the image
+     * 
+     * @return int - width_ * pixel_size_ rounded up to IMAGE_ROW_ALIGNMENT
+     */
+    int nativeRowStride();
+
+
+    /**
+     * @brief Allocate memmory for image data (width_ * height_) in the pixel format of the image<br>
+     * (the content is undefined)
+     * 
+     */
+    void allocateNativeMemmory();
+
+
+    /**
+     * @brief Get the color as it is stored in the view of the pixel format
+     * 
+     * @param[in] color color
+     * @param[out] native_color the color for the view (palette images: index in all components)
+     * @param[in] add_to_palette add the color to a palette that is not full
+     * @return true - if the color can be stored in the pixel format
+     * @return false - if the image must be converted to RGBA to store the color
+     */
+    bool toNativeColor(Color color, Color *native_color, bool add_to_palette);
+
+
+    /**
+     * @brief Get the color of a pixel read from the view of the pixel format
+     * 
+     * @param[in] native_color color read from the view
+     * @return Color - color
+     */
+    Color fromNativeColor(Color native_color);
+
+
+    /**
+     * @brief Check if all the palette colors differ
+     * 
+     * @return true - if there are no same colors
+     * @return false - if some colors are the same
+     */
+    bool isPaletteUnique();
+
+
+    /**
+     * @brief Call the function with the view of the image data for the pixel format<br>
+     * (ImageView<PixelGray>, ImageView<PixelGrayAlpha>, ImageView<PixelRGB> or ImageView<PixelRGBA>; 
+     * palette images are viewed as gray images of indices)
+     * 
+     * @param[in] writable the function changes the image data
+     * @param[in] function function taking the view
+     */
+    template <class Function>
+    void forNativeView(bool writable, Function function)
+    {
+        if (writable) {
+            makeWritable();
+        }
+        unsigned char *origin = buffer_.getData();
+
+        switch (color_type_) {
+            case PNG_COLOR_TYPE_GRAY:
+            case PNG_COLOR_TYPE_PALETTE:
+                function(ImageView<PixelGray>(origin, width_, height_, stride_));
+                break;
+            case PNG_COLOR_TYPE_GRAY_ALPHA:
+                function(ImageView<PixelGrayAlpha>(origin, width_, height_, stride_));
+                break;
+            case PNG_COLOR_TYPE_RGB:
+                function(ImageView<PixelRGB>(origin, width_, height_, stride_));
+                break;
+            default:
+                function(ImageView<PixelRGBA>(origin, width_, height_, stride_));
+                break;
+        }
+    }
+
+
+    /**
+     * @brief Reads info structure
+     * 
+     */
+    void readInfoFields();
 
 
     /**
-     * @brief Fill pilygon<br>
-     * (used by DrawPolygon)
+     * @brief Set the input transformations to 8 bits per component<br>
+     * (palette images keep the indices and palette_ is read, transparency is expanded to alpha)
      * 
-     * @param[in] vertices the vector of polygon coordinates in the order of their connection
-     * @param[in] fill_color polygon fill color
+     * @param[in] to_rgba convert all images to 8-bit/color RGBA
      */
-    void fillPolygon(std::vector<Coord>& vertices, ColorRGBA& fill_color);
+    void transformInput(bool to_rgba);
 };
 
 }
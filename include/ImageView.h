@@ -0,0 +1,1222 @@
+/**
+ * @file ImageView.h
+ * @brief Header with a description and implementation of the ImageView class template
+ * (non-owning rectangular area of an image with all the drawing and color processing algorithms)
+ * @version 0.1.0
+ * @date 2026-10-17
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+#ifndef IMAGE_VIEW_H
+#define IMAGE_VIEW_H
+
+#include "Structures.h"
+#include "PixelTraits.h"
+#include "Execution.h"
+#include "PixelKernels.h"
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <vector>
+#include <queue>
+#include <utility>
+#include <algorithm>
+
+#define IMAGE_VERTICAL                  0
+#define IMAGE_HORIZONTAL                1
+
+/**
+ * @brief namespace of ImageEditor.h
+ * 
+ */
+namespace ie
+{
+
+/**
+ * @brief Structure template for representing pixels of a row without coordinate checks<br>
+ * (index i is the i-th pixel from data; used by loops over areas clipped once)
+ * 
+ */
+template <class PixelTraits>
+struct PixelSpan
+{
+    typedef typename PixelTraits::Color Color;
+
+    unsigned char  *data;     ///< the first pixel (NULL if the span is empty)
+    int            size;      ///< number of pixels
+
+    /**
+     * @brief Read the pixel color
+     * 
+     * @param[in] i index of the pixel [0..size-1]
+     * @return Color - pixel color
+     */
+    Color get(int i) const
+    {
+        return PixelTraits::load(data + (size_t)i*PixelTraits::pixel_size);
+    }
+
+    /**
+     * @brief Write the pixel color
+     * 
+     * @param[in] i index of the pixel [0..size-1]
+     * @param[in] color pixel color
+     */
+    void set(int i, Color color) const
+    {
+        PixelTraits::store(data + (size_t)i*PixelTraits::pixel_size, color);
+    }
+};
+
+
+/**
+ * @brief Class template for a rectangular area of pixels that the view does not own<br>
+ * (pointer to the first pixel, width, height and the distance in bytes between rows, 
+ * the distance can be negative for images stored bottom-up)<br>
+ * (the view is valid while the memmory it references is not freed or reallocated)
+ * 
+ */
+template <class PixelTraits>
+class ImageView
+{
+public:
+
+    typedef typename PixelTraits::Color Color;
+
+
+    /**
+     * @brief Construct an empty ImageView object
+     * 
+     */
+    ImageView();
+
+
+    /**
+     * @brief Construct a new ImageView object
+     * 
+     * @param[in] origin pointer to the first pixel of the first row
+     * @param[in] width view width
+     * @param[in] height view height
+     * @param[in] step distance in bytes from the beginning of a row to the beginning of the next one
+     */
+    ImageView(unsigned char *origin, int width, int height, ptrdiff_t step);
+
+
+    /**
+     * @brief Get the Width view
+     * 
+     * @return int - view width
+     */
+    int getWidth();
+
+
+    /**
+     * @brief Get the Height view
+     * 
+     * @return int - view height
+     */
+    int getHeight();
+
+
+    /**
+     * @brief Get the first byte of the row
+     * 
+     * @param[in] y the Y coordinate of the row
+     * @return unsigned char* - pointer to the row
+     */
+    unsigned char* row(int y);
+
+
+    /**
+     * @brief Get the pixels of a part of the row<br>
+     * (the part is clipped to the view once, so the loop over it needs no checks)
+     * 
+     * @param[in] y the Y coordinate of the row
+     * @param[in] x0 the X coordinate of the first pixel
+     * @param[in] x1 the X coordinate of the last pixel
+     * @return PixelSpan<PixelTraits> - pixels from x0 to x1 (empty if the row is outside 
+     * the view or x0 > x1 after clipping)
+     */
+    PixelSpan<PixelTraits> span(int y, int x0, int x1);
+
+
+    /**
+     * @brief Get the pixel color without checking the coordinates
+     * 
+     * @param[in] x the X coordinate of the pixel (must be inside the view)
+     * @param[in] y the Y coordinate of the pixel (must be inside the view)
+     * @return Color - pixel color
+     */
+    Color at(int x, int y);
+
+
+    /**
+     * @brief Set the pixel color without checking the coordinates
+     * 
+     * @param[in] x the X coordinate of the pixel (must be inside the view)
+     * @param[in] y the Y coordinate of the pixel (must be inside the view)
+     * @param[in] color pixel color
+     */
+    void setAt(int x, int y, Color color);
+
+
+    /**
+     * @brief Get a view of a part of this view<br>
+     * (the area is clipped to the view)
+     * 
+     * @param[in] x0 the X coordinate of upper left corner of the area
+     * @param[in] y0 the Y coordinate of upper left corner of the area
+     * @param[in] x1 the X coordinate of lower right corner of the area
+     * @param[in] y1 the Y coordinate of lower right corner of the area
+     * @return ImageView - view of the area
+     */
+    ImageView subView(int x0, int y0, int x1, int y1);
+
+
+    /**
+     * @brief Get the pixel color
+     * 
+     * @param[in] x the X coordinate of the pixel
+     * @param[in] y the Y coordinate of the pixel
+     * @return Color - pixel color (all components are 0 outside the view)
+     */
+    Color getColor(int x, int y);
+
+
+    /**
+     * @brief Set the pixel color
+     * 
+     * @param[in] x the X coordinate of the pixel
+     * @param[in] y the Y coordinate of the pixel
+     * @param[in] color pixel color
+     */
+    void setColor(int x, int y, Color color);
+
+
+    /**
+     * @brief Clear the view<br>
+     * (sets all components of all pixels to 0)
+     * 
+     */
+    void clear();
+
+
+    /**
+     * @brief Insert pixels of src_view at the position x0, y0 for the upper-left corner<br>
+     * (src_view may overlap this view)
+     * 
+     * @param[in] src_view pixels to copy
+     * @param[in] x0 the X coordinate of upper left corner of insertion
+     * @param[in] y0 the Y coordinate of upper left corner of insertion
+     */
+    void paste(ImageView src_view, int x0, int y0);
+
+
+    /**
+     * @brief Reflect the view
+     * 
+     * @param[in] reflection_type type of reflection (format can be: VERTICAL or HORIZONTAL)
+     */
+    void reflect(int reflection_type);
+
+
+    /**
+     * @brief Draw Bresenham line<br>
+     * (line with thickness 1)
+     * 
+     * @param[in] x0 the X coordinate of the beginning of the line
+     * @param[in] y0 the Y coordinate of the beginning of the line
+     * @param[in] x1 the X coordinate of the end of the line
+     * @param[in] y1 the Y coordinate of the end of the line
+     * @param[in] color line color
+     */
+    void drawBresenhamLine(int x0, int y0, int x1, int y1, Color color);
+
+
+    /**
+     * @brief Draw Bresenham line<br>
+     * (line with any thickness)<br>
+     * (thickness is set by drawing parallel lines by the Bresenham algorithm)
+     * 
+     * @param[in] x0 the X coordinate of the beginning of the line
+     * @param[in] y0 the Y coordinate of the beginning of the line
+     * @param[in] x1 the X coordinate of the end of the line
+     * @param[in] y1 the Y coordinate of the end of the line
+     * @param[in] color line color
+     */
+    void drawMurphyLine(int x0, int y0, int x1, int y1,
+        int thickness, Color color);
+
+
+    /**
+     * @brief Draw line<br>
+     * (line with any thickness)<br>
+     * (thickness is set by drawing circles at each point of the line)
+     * 
+     * @param[in] x0 the X coordinate of the beginning of the line
+     * @param[in] y0 the Y coordinate of the beginning of the line
+     * @param[in] x1 the X coordinate of the end of the line
+     * @param[in] y1 the Y coordinate of the end of the line
+     * @param[in] thickness thickenss of the line
+     * @param[in] color line color
+     */
+    void drawLine(int x0, int y0, int x1, int y1,
+        int thickness, Color color);
+
+
+    /**
+     * @brief Draw Bresenham circle<br>
+     * (circle with thickness 1)
+     * 
+     * @param[in] x0 the X coordinate of the center of the circle
+     * @param[in] y0 the X coordinate of the center of the circle
+     * @param[in] radius circle radius
+     * @param[in] color circle color
+     */
+    void drawBresenhamCircle(int x0, int y0, int radius, Color color);
+
+
+    /**
+     * @brief Draw circle<br>
+     * (circle with any thickness)
+     * 
+     * @param[in] x0 the X coordinate of the center of the circle
+     * @param[in] y0 the X coordinate of the center of the circle
+     * @param[in] radius circle radius
+     * @param[in] thickness circle thickness
+     * @param[in] color circle color
+     * @param[in] fill should it be filled in (format can be: true or false)
+     * @param[in] fill_color circle fill color
+     */
+    void drawCircle(int x0, int y0, int radius, int thickness,
+        Color color, bool fill, Color fill_color);
+
+
+    /**
+     * @brief Draw polygon<br>
+     * (polygon with any thickness)<br>
+     * (used alg: scan line)
+     * 
+     * @param[in] vertices the vector of polygon coordinates in the order of their connection
+     * @param[in] thickness polygon thickness
+     * @param[in] color polygon color
+     * @param[in] fill should it be filled in (true or false)
+     * @param[in] fill_color polygon fill color
+     */
+    void drawPolygon(std::vector<Coord> vertices, int thickness,
+        Color color, bool fill, Color fill_color);
+
+
+    /**
+     * @brief Check if point is in polygon
+     * 
+     * @param[in] x the X coordinate of point
+     * @param[in] y the X coordinate of point
+     * @param[in] vertices the vector of polygon coordinates in the order of their connection
+     * @return true - point is in the polygon
+     * @return false - point is not in the polygon
+     */
+    bool inPolygon(int x, int y, std::vector<Coord>& vertices);
+
+
+    /**
+     * @brief Replace a certain color with a new one
+     * 
+     * @param[in] old_color old color
+     * @param[in] new_color new color
+     */
+    void colorReplace(Color old_color, Color new_color);
+
+
+    /**
+     * @brief Replace a certain color component
+     * 
+     * @param[in] component_idx color component (format can be: R_IDX, G_IDX or B_IDX)
+     * @param[in] component_value the new value of the component (format: [0..255])
+     */
+    void componentFilter(int component_idx, unsigned char component_value);
+
+
+    /**
+     * @brief Inverts the colors of the view
+     * 
+     */
+    void inverseColors();
+
+
+    /**
+     * @brief Converts the view to black and white
+     * 
+     * @param[in] method gray method (format can be: GRAY_BT601, GRAY_BT709, GRAY_AVERAGE or GRAY_LIGHTNESS)
+     */
+    void grayColors(int method = GRAY_BT601);
+
+
+    /**
+     * @brief Write the gray values of the view to a one-channel view<br>
+     * (the area of the size of the smaller view is converted)
+     * 
+     * @param[out] dst_view view of gray pixels (must not overlap this view)
+     * @param[in] method gray method (format can be: GRAY_BT601, GRAY_BT709, GRAY_AVERAGE or GRAY_LIGHTNESS)
+     */
+    void grayToChannel(ImageView<PixelGray> dst_view, int method = GRAY_BT601);
+
+
+    /**
+     * @brief Fill area with color
+     * 
+     * @param[in] x the X coordinate of the beginning of the fill
+     * @param[in] y the Y coordinate of the beginning of the fill
+     * @param[in] color fill color
+     */
+    void floodFill(int x, int y, Color color);
+
+
+    /**
+     * @brief Call the function for every row of the view<br>
+     * (the rows are split into bands of about IMAGE_BAND_SIZE bytes; with a parallel policy 
+     * the bands are processed on all cores, so the function must be safe to call from several threads)
+     * 
+     * @param[in] policy execution policy (execution::seq, execution::par or execution::par_unseq)
+     * @param[in] function function taking the Y coordinate and the PixelSpan of the row
+     */
+    template <class ExecutionPolicy, class Function>
+    void forEachRow(ExecutionPolicy policy, Function function);
+
+
+    /**
+     * @brief Call the function for every pixel of the view without changing it<br>
+     * (see forEachRow for how the work is split)
+     * 
+     * @param[in] policy execution policy (execution::seq, execution::par or execution::par_unseq)
+     * @param[in] function function taking the X and Y coordinates and the color of the pixel
+     */
+    template <class ExecutionPolicy, class Function>
+    void forEachPixel(ExecutionPolicy policy, Function function);
+
+
+    /**
+     * @brief Replace the color of every pixel of the view with the result of the function<br>
+     * (see forEachRow for how the work is split; with execution::par_unseq the loop over 
+     * a row may be vectorized)
+     * 
+     * @param[in] policy execution policy (execution::seq, execution::par or execution::par_unseq)
+     * @param[in] function function taking the color of the pixel and returning the new color
+     */
+    template <class ExecutionPolicy, class Function>
+    void transformPixels(ExecutionPolicy policy, Function function);
+
+
+protected:
+
+    unsigned char        *origin_;
+    int                  width_;
+    int                  height_;
+    ptrdiff_t            step_;
+
+
+    /**
+     * @brief Check if coordinate belongs to the view
+     * 
+     * @param[in] x the X coordinate of the pixel
+     * @param[in] y the Y coordinate of the pixel
+     * @return true - coordinate belongs to the view
+     * @return false - coordinate does not belong to the view
+     */
+    bool checkCoordsValidity(int x, int y);
+
+
+private:
+
+    /**
+     * @brief Draw Bresenham line low<br>
+     * (line with thickness 1 and slope < 1)<br>
+     * (method used by DrawBresenhamLine)
+     * 
+     * @param[in] x0 X coordinate of the beginning of the line
+     * @param[in] y0 Y coordinate of the beginning of the line
+     * @param[in] x1 X coordinate of the end of the line
+     * @param[in] y1 Y coordinate of the end of the line
+     * @param[in] color line color
+     */
+    void drawBresenhamLineLow(int x0, int y0, int x1, int y1, Color color);
+
+
+    /**
+     * @brief Draw Bresenham line high<br>
+     * (line with thickness 1 and slope > 1)<br>
+     * (method used by DrawBresenhamLine)
+     * 
+     * @param[in] x0 X coordinate of the beginning of the line
+     * @param[in] y0 Y coordinate of the beginning of the line
+     * @param[in] x1 X coordinate of the end of the line
+     * @param[in] y1 Y coordinate of the end of the line
+     * @param[in] color line color
+     */
+    void drawBresenhamLineHigh(int x0, int y0, int x1, int y1, Color color);
+
+
+    /**
+     * @brief Draw line high<br>
+     * (line with thickness 1 and slope < 1)<br>
+     * (method used by DrawLine)
+     * 
+     * @param[in] x0 X coordinate of the beginning of the line
+     * @param[in] y0 Y coordinate of the beginning of the line
+     * @param[in] x1 X coordinate of the end of the line
+     * @param[in] y1 Y coordinate of the end of the line
+     * @param[in] color line color
+     */
+    void drawLineHigh(int x0, int y0, int x1, int y1,
+        int thickness, Color color);
+
+
+    /**
+     * @brief Draw line high<br>
+     * (line with thickness 1 and slope > 1)<br>
+     * (method used by DrawLine)
+     * 
+     * @param[in] x0 X coordinate of the beginning of the line
+     * @param[in] y0 Y coordinate of the beginning of the line
+     * @param[in] x1 X coordinate of the end of the line
+     * @param[in] y1 Y coordinate of the end of the line
+     * @param[in] color line color
+     */
+    void drawLineLow(int x0, int y0, int x1, int y1,
+        int thickness, Color color);
+
+
+    /**
+     * @brief check if point is on the circle line
+     * 
+     * @param x[in] the X coordinate of the point being checked
+     * @param y[in] the Y coordinate of the the point being checked
+     * @param x0[in] the X coordinate of the circle center
+     * @param y0[in] the Y coordinate of the circle center
+     * @param radius[in] circle radius
+     * @param thickness[in] thickness of outline
+     * @return true - if point on circle line
+     * @return false - if point is not on circle line
+     */
+    bool checkOnCircleLine(int x, int y, int x0, int y0, int radius, int thickness);
+
+
+    /**
+     * @brief check if point is in the circle
+     * 
+     * @param x[in] the X coordinate of the point being checked
+     * @param y[in] the Y coordinate of the the point being checked
+     * @param x0[in] the X coordinate of the circle center
+     * @param y0[in] the Y coordinate of the circle center
+     * @param radius[in] circle radius
+     * @param thickness[in] thickness of outline
+     * @return true - if point is in the circle
+     * @return false - if point is not in the circle
+     */
+    bool checkInCircle(int x, int y, int x0, int y0, int radius, int thickness);
+
+
+    /**
+     * @brief the function gets the intersection points of y = const and polygon
+     * 
+     * @param[out] intersections a vector that stores the intersections of the line y = const with the sides of the polygon
+     * @param[in] y const
+     * @param[in] vertices vertices of the polygon
+     */
+    void getPolygonIntersections(std::vector<std::pair<int, int>>& intersections,
+        int y, std::vector<ie::Coord>& vertices);
+
+
+    /**
+     * @brief Fill pilygon<br>
+     * (used by DrawPolygon)
+     * 
+     * @param[in] vertices the vector of polygon coordinates in the order of their connection
+     * @param[in] fill_color polygon fill color
+     */
+    void fillPolygon(std::vector<Coord>& vertices, Color& fill_color);
+};
+
+
+/*
+ * View data (pixel access)
+ */
+
+template <class PixelTraits>
+ImageView<PixelTraits>::ImageView() :
+    origin_(NULL),
+    width_(0),
+    height_(0),
+    step_(0)
+{}
+
+template <class PixelTraits>
+ImageView<PixelTraits>::ImageView(unsigned char *origin, int width, int height, ptrdiff_t step) :
+    origin_(origin),
+    width_(width),
+    height_(height),
+    step_(step)
+{}
+
+template <class PixelTraits>
+int ImageView<PixelTraits>::getWidth()
+{
+    return width_;
+}
+
+template <class PixelTraits>
+int ImageView<PixelTraits>::getHeight()
+{
+    return height_;
+}
+
+template <class PixelTraits>
+unsigned char* ImageView<PixelTraits>::row(int y)
+{
+    return origin_ + step_*y;
+}
+
+template <class PixelTraits>
+PixelSpan<PixelTraits> ImageView<PixelTraits>::span(int y, int x0, int x1)
+{
+    x0 = std::max(x0, 0);
+    x1 = std::min(x1, width_-1);
+    if (y < 0 || y >= height_ || x0 > x1) {
+        return {NULL, 0};
+    }
+    return {row(y) + x0*PixelTraits::pixel_size, x1-x0+1};
+}
+
+template <class PixelTraits>
+typename ImageView<PixelTraits>::Color ImageView<PixelTraits>::at(int x, int y)
+{
+    return PixelTraits::load(row(y) + x*PixelTraits::pixel_size);
+}
+
+template <class PixelTraits>
+void ImageView<PixelTraits>::setAt(int x, int y, Color color)
+{
+    PixelTraits::store(row(y) + x*PixelTraits::pixel_size, color);
+}
+
+template <class PixelTraits>
+ImageView<PixelTraits> ImageView<PixelTraits>::subView(int x0, int y0, int x1, int y1)
+{
+    if (x0 > x1) {
+        std::swap(x0, x1);
+    }
+    if (y0 > y1) {
+        std::swap(y0, y1);
+    }
+
+    x0 = std::max(x0, 0);
+    y0 = std::max(y0, 0);
+    x1 = std::min(x1, width_-1);
+    y1 = std::min(y1, height_-1);
+
+    if (x0 > x1 || y0 > y1) {
+        return ImageView();
+    }
+    return ImageView(row(y0) + x0*PixelTraits::pixel_size, x1-x0+1, y1-y0+1, step_);
+}
+
+template <class PixelTraits>
+bool ImageView<PixelTraits>::checkCoordsValidity(int x, int y)
+{
+    return (x >= 0 && x < width_ && y >= 0 && y < height_);
+}
+
+template <class PixelTraits>
+typename ImageView<PixelTraits>::Color ImageView<PixelTraits>::getColor(int x, int y)
+{
+    if (!checkCoordsValidity(x, y)) {
+        return Color();
+    }
+
+    return PixelTraits::load(row(y) + x*PixelTraits::pixel_size);
+}
+
+template <class PixelTraits>
+void ImageView<PixelTraits>::setColor(int x, int y, Color color)
+{
+    if (!checkCoordsValidity(x, y)) {
+        return;
+    }
+    PixelTraits::store(row(y) + x*PixelTraits::pixel_size, color);
+}
+
+
+/*
+ * Process shape (paste, reflect)
+ */
+
+template <class PixelTraits>
+void ImageView<PixelTraits>::paste(ImageView src_view, int x0, int y0)
+{
+    int src_x = std::max(0, -x0);
+    int src_y = std::max(0, -y0);
+    int copy_width = std::min(src_view.getWidth(), width_ - x0) - src_x;
+    int copy_height = std::min(src_view.getHeight(), height_ - y0) - src_y;
+
+    if (copy_width <= 0 || copy_height <= 0) {
+        return;
+    }
+
+    size_t row_size = (size_t)copy_width*PixelTraits::pixel_size;
+    unsigned char *dst_first = row(y0 + src_y) + (x0 + src_x)*PixelTraits::pixel_size;
+    unsigned char *src_first = src_view.row(src_y) + src_x*PixelTraits::pixel_size;
+
+    /* rows are copied in the order that does not overwrite unread source rows */
+    if ((dst_first > src_first && step_ > 0) || (dst_first < src_first && step_ < 0)) {
+        for (int y = copy_height-1; y >= 0; y--) {
+            memmove(dst_first + step_*y, src_first + src_view.step_*y, row_size);
+        }
+    } else {
+        for (int y = 0; y < copy_height; y++) {
+            memmove(dst_first + step_*y, src_first + src_view.step_*y, row_size);
+        }
+    }
+}
+
+template <class PixelTraits>
+void ImageView<PixelTraits>::reflect(int reflection_type)
+{
+    if (reflection_type == IMAGE_VERTICAL) {
+        for (int y = 0; y < height_/2; y++) {
+            for (int x = 0; x < width_; x++) {
+                Color a = at(x, y);
+                Color b = at(x, height_-y-1);
+                setAt(x, y, b);
+                setAt(x, height_-y-1, a);
+            }
+        }
+    }
+    if (reflection_type == IMAGE_HORIZONTAL) {
+        for (int y = 0; y < height_; y++) {
+            for (int x = 0; x < width_/2; x++) {
+                Color a = at(x, y);
+                Color b = at(width_-x-1, y);
+                setAt(x, y, b);
+                setAt(width_-x-1, y, a);
+            }
+        }
+    }
+}
+
+
+/*
+ * Process colors (inverse (inverse colors), gray (convert to black and white), etc.)
+ */
+
+template <class PixelTraits>
+void ImageView<PixelTraits>::clear()
+{
+    for (int y = 0; y < height_; y++) {
+        memset(row(y), 0, (size_t)width_*PixelTraits::pixel_size);
+    }
+}
+
+template <class PixelTraits>
+void ImageView<PixelTraits>::colorReplace(Color old_color, Color new_color)
+{
+    for (int y = 0; y < height_; y++) {
+        PixelSpan<PixelTraits> pixels = span(y, 0, width_-1);
+        for (int i = 0; i < pixels.size; i++) {
+            if (pixels.get(i) == old_color) {
+                pixels.set(i, new_color);
+            }
+        }
+    }
+}
+
+template <class PixelTraits>
+void ImageView<PixelTraits>::componentFilter(int component_idx, unsigned char component_value)
+{
+    int offset = -1;
+    if (component_idx == R_IDX) {
+        offset = PixelTraits::r_offset;
+    } else if (component_idx == G_IDX) {
+        offset = PixelTraits::g_offset;
+    } else if (component_idx == B_IDX) {
+        offset = PixelTraits::b_offset;
+    }
+
+    if (offset < 0) {
+        return;
+    }
+
+    RowMask mask;
+    mask.setPixelByte(PixelTraits::pixel_size, offset, 0, component_value);
+    for (int y = 0; y < height_; y++) {
+        applyRowMask(row(y), (size_t)width_*PixelTraits::pixel_size, mask);
+    }
+}
+
+template <class PixelTraits>
+void ImageView<PixelTraits>::inverseColors()
+{
+    /* the color components are XORed with 255, the alpha is kept */
+    RowMask mask;
+    for (int offset = 0; offset < PixelTraits::pixel_size; offset++) {
+        if (offset != PixelTraits::a_offset) {
+            mask.setPixelByte(PixelTraits::pixel_size, offset, 0xFF, 0xFF);
+        }
+    }
+    for (int y = 0; y < height_; y++) {
+        applyRowMask(row(y), (size_t)width_*PixelTraits::pixel_size, mask);
+    }
+}
+
+template <class PixelTraits>
+void ImageView<PixelTraits>::grayColors(int method)
+{
+    /* gray pixel formats do not change */
+    if (PixelTraits::r_offset == PixelTraits::g_offset && PixelTraits::g_offset == PixelTraits::b_offset) {
+        return;
+    }
+
+    for (int y = 0; y < height_; y++) {
+        grayRow(row(y), width_, PixelTraits::pixel_size, 
+                PixelTraits::r_offset, PixelTraits::g_offset, PixelTraits::b_offset, method);
+    }
+}
+
+template <class PixelTraits>
+void ImageView<PixelTraits>::grayToChannel(ImageView<PixelGray> dst_view, int method)
+{
+    int width = std::min(width_, dst_view.getWidth());
+    int height = std::min(height_, dst_view.getHeight());
+
+    for (int y = 0; y < height; y++) {
+        grayRowToChannel(row(y), dst_view.row(y), width, PixelTraits::pixel_size, 
+                         PixelTraits::r_offset, PixelTraits::g_offset, PixelTraits::b_offset, method);
+    }
+}
+
+
+/*
+ * Filling algs
+ */
+
+template <class PixelTraits>
+void ImageView<PixelTraits>::floodFill(int x, int y, Color color)
+{
+    Color start_color = getColor(x, y);
+
+    std::queue<Coord> coords;
+    coords.push({x, y});
+
+    while (!coords.empty()) {
+        Coord coord = coords.front();
+        if (checkCoordsValidity(coord.x, coord.y) && getColor(coord.x, coord.y) == start_color) {
+            setColor(coord.x, coord.y, color);
+            coords.push({coord.x+1, coord.y});
+            coords.push({coord.x-1, coord.y});
+            coords.push({coord.x, coord.y+1});
+            coords.push({coord.x, coord.y-1});
+        }
+        coords.pop();
+    }
+}
+
+
+/*
+ * Bresenham line (with thickness = 1)
+ */
+
+template <class PixelTraits>
+void ImageView<PixelTraits>::drawBresenhamLineLow(int x0, int y0, int x1, int y1, Color color)
+{
+    int dx = x1 - x0;
+    int dy = y1 - y0;
+    int yi = 1;
+    if (dy < 0) {
+        yi = -1;
+        dy = -dy;
+    }
+    int D = 2 * dy - dx;
+    int y = y0;
+    for (int x = x0; x <= x1; x++) {
+        setColor(x, y, color);
+
+        if (D > 0) {
+            y += yi;
+            D += 2 * (dy - dx);
+        } else {
+            D += 2 * dy;
+        }
+    }
+}
+
+template <class PixelTraits>
+void ImageView<PixelTraits>::drawBresenhamLineHigh(int x0, int y0, int x1, int y1, Color color)
+{
+
+    int dx = x1 - x0;
+    int dy = y1 - y0;
+    int xi = 1;
+    if (dx < 0) {
+        xi = -1;
+        dx = -dx;
+    }
+    int D = (2 * dx) - dy;
+    int x = x0;
+    for (int y = y0; y <= y1; y++) {
+        setColor(x, y, color);
+
+        if (D > 0) {
+            x += xi;
+            D += 2 * (dx - dy);
+        } else {
+            D += 2 * dx;
+        }
+    }
+}
+
+template <class PixelTraits>
+void ImageView<PixelTraits>::drawBresenhamLine(int x0, int y0, int x1, int y1, Color color)
+{
+    if (abs(y1 - y0) < abs(x1 - x0)) {
+        if (x0 > x1) {
+            std::swap(x0, x1);
+            std::swap(y0, y1);
+        }
+        drawBresenhamLineLow(x0, y0, x1, y1, color);
+    } else {
+        if (y0 > y1) {
+            std::swap(x0, x1);
+            std::swap(y0, y1);
+        }
+        drawBresenhamLineHigh(x0, y0, x1, y1, color);
+    }
+}
+
+
+/*
+ * Murphy line (with any thickness)
+ */
+
+template <class PixelTraits>
+void ImageView<PixelTraits>::drawMurphyLine(int x0, int y0, int x1, int y1,
+    int thickness, Color color)
+{
+    if (abs(y1 - y0) < abs(x1 - x0)) {
+        if (x0 > x1) {
+            std::swap(x0, x1);
+            std::swap(y0, y1);
+        }
+        for (int i = 0; i <= thickness/2; i++) {
+            drawBresenhamLineLow(x0, y0-i, x1, y1-i, color);
+            drawBresenhamLineLow(x0, y0+i, x1, y1+i, color);
+        }
+    } else {
+        if (y0 > y1) {
+            std::swap(x0, x1);
+            std::swap(y0, y1);
+        }
+        for (int i = 0; i <= thickness/2; i++) {
+            drawBresenhamLineHigh(x0-i, y0, x1-i, y1, color);
+            drawBresenhamLineHigh(x0+i, y0, x1+i, y1, color);
+        }
+    }
+}
+
+
+/*
+ * Line (with any thickness)
+ */
+
+template <class PixelTraits>
+void ImageView<PixelTraits>::drawLineLow(int x0, int y0, int x1, int y1,
+    int thickness, Color color)
+{
+    int dx = x1 - x0;
+    int dy = y1 - y0;
+    int yi = 1;
+    if (dy < 0) {
+        yi = -1;
+        dy = -dy;
+    }
+    int D = 2 * dy - dx;
+    int y = y0;
+    for (int x = x0; x <= x1; x++) {
+        drawCircle(x, y, thickness/2, 1, color, true, color);
+
+        if (D > 0) {
+            y += yi;
+            D += 2 * (dy - dx);
+        } else {
+            D += 2 * dy;
+        }
+    }
+}
+
+template <class PixelTraits>
+void ImageView<PixelTraits>::drawLineHigh(int x0, int y0, int x1, int y1,
+    int thickness, Color color)
+{
+
+    int dx = x1 - x0;
+    int dy = y1 - y0;
+    int xi = 1;
+    if (dx < 0) {
+        xi = -1;
+        dx = -dx;
+    }
+    int D = (2 * dx) - dy;
+    int x = x0;
+    for (int y = y0; y <= y1; y++) {
+        drawCircle(x, y, thickness/2, 1, color, true, color);
+
+        if (D > 0) {
+            x += xi;
+            D += 2 * (dx - dy);
+        } else {
+            D += 2 * dx;
+        }
+    }
+}
+
+template <class PixelTraits>
+void ImageView<PixelTraits>::drawLine(int x0, int y0, int x1, int y1,
+    int thickness, Color color)
+{
+    if (abs(y1 - y0) < abs(x1 - x0)) {
+        if (x0 > x1) {
+            std::swap(x0, x1);
+            std::swap(y0, y1);
+        }
+        drawLineLow(x0, y0, x1, y1, thickness, color);
+    } else {
+        if (y0 > y1) {
+            std::swap(x0, x1);
+            std::swap(y0, y1);
+        }
+        drawLineHigh(x0, y0, x1, y1, thickness, color);
+    }
+}
+
+
+/*
+ * Bresenham circle (with thickness = 1)
+ */
+
+template <class PixelTraits>
+void ImageView<PixelTraits>::drawBresenhamCircle(int x0, int y0, int radius, Color color)
+{
+    int D = 3 - 2 * radius;
+    int x = 0;
+    int y = radius;
+    while (x <= y) {
+        setColor(x+x0, y+y0, color);
+        setColor(y+x0, x+y0, color);
+        setColor(-y+x0, x+y0, color);
+        setColor(-x+x0, y+y0, color);
+        setColor(-x+x0, -y+y0, color);
+        setColor(-y+x0, -x+y0, color);
+        setColor(y+x0, -x+y0, color);
+        setColor(x+x0, -y+y0, color);
+
+        if (D < 0) {
+            D += 4 * x + 6;
+            x++;
+        } else {
+            D += 4 * (x - y) + 10;
+            x++;
+            y--;
+        }
+    }
+}
+
+
+/*
+ * Circle (with any thickness)
+ */
+
+template <class PixelTraits>
+bool ImageView<PixelTraits>::checkOnCircleLine(int x, int y, int x0, int y0, int radius, int thickness)
+{
+    bool flag1 = (x-x0)*(x-x0) + (y-y0)*(y-y0) <= (radius+thickness/2)*(radius+thickness/2);
+    bool flag2 = (x-x0)*(x-x0) + (y-y0)*(y-y0) >= (std::max(0, radius-thickness/2))*(std::max(0, radius-thickness/2));
+    return flag1 && flag2;
+}
+
+template <class PixelTraits>
+bool ImageView<PixelTraits>::checkInCircle(int x, int y, int x0, int y0, int radius, int thickness)
+{
+    bool flag = (x-x0)*(x-x0) + (y-y0)*(y-y0) <= (radius-thickness/2)*(radius-thickness/2);
+    return flag;
+}
+
+template <class PixelTraits>
+void ImageView<PixelTraits>::drawCircle(int x0, int y0, int radius, int thickness,
+    Color color, bool fill, Color fill_color)
+{
+    for (int y = std::max(0, y0-radius-thickness/2); y <= std::min(height_-1, y0+radius+thickness/2); y++) {
+        for (int x = std::max(0, x0-radius-thickness/2); x <= std::min(width_-1, x0+radius+thickness/2); x++) {
+            if (fill && checkInCircle(x, y, x0, y0, radius, thickness)) {
+                setAt(x, y, fill_color);
+            }
+            if (checkOnCircleLine(x, y, x0, y0, radius, thickness)) {
+                setAt(x, y, color);
+            }
+        }
+    }
+
+    drawBresenhamCircle(x0, y0, radius-thickness/2, color);
+    drawBresenhamCircle(x0, y0, radius+thickness/2, color);
+}
+
+
+/*
+ * Polygon (with any thickness) + function of checking whether the point is inside the polygon
+ */
+
+template <class PixelTraits>
+bool ImageView<PixelTraits>::inPolygon(int x0, int y0, std::vector<Coord>& vertices)
+{
+    int intersections_counter = 0;
+    for (int i = 0; i < vertices.size(); i++) {
+        int next = (i + 1) % vertices.size();
+
+        if ((vertices[i].y > y0 && vertices[next].y <= y0) || (vertices[next].y > y0 && vertices[i].y <= y0)) {
+            if ((vertices[next].y - vertices[i].y) < 0) {
+                if ((x0 * (vertices[next].y - vertices[i].y)) < ((vertices[next].y - vertices[i].y) * vertices[i].x + (y0 - vertices[i].y) * (vertices[next].x - vertices[i].x))) {
+                    intersections_counter++;
+                }
+            } else {
+                if ((x0 * (vertices[next].y - vertices[i].y)) > ((vertices[next].y - vertices[i].y) * vertices[i].x + (y0 - vertices[i].y) * (vertices[next].x - vertices[i].x))) {
+                    intersections_counter++;
+                }
+            }
+        }
+    }
+    return (intersections_counter % 2);
+}
+
+template <class PixelTraits>
+void ImageView<PixelTraits>::getPolygonIntersections(std::vector<std::pair<int, int>>& intersections,
+    int y, std::vector<ie::Coord>& vertices)
+{
+    for (int i = 0; i < vertices.size(); i++) {
+        int next = (i + 1) % vertices.size();
+
+        if ((vertices[i].y > y && vertices[next].y <= y) ||
+            (vertices[next].y > y && vertices[i].y <= y)) {
+
+            intersections.push_back(
+                {
+                (vertices[next].y - vertices[i].y) * vertices[i].x + (y - vertices[i].y) * (vertices[next].x - vertices[i].x),
+                (vertices[next].y - vertices[i].y)
+                }
+                );
+        }
+    }
+}
+
+template <class PixelTraits>
+void ImageView<PixelTraits>::fillPolygon(std::vector<Coord>& vertices, Color& fill_color)
+{
+    int y_min = INT_MAX;
+    int y_max = INT_MIN;
+    for (int i = 0; i < vertices.size(); i++) {
+        y_min = std::min(y_min, vertices[i].y);
+        y_max = std::max(y_max, vertices[i].y);
+    }
+
+    for (int y = y_min; y <= y_max; y++) {
+        std::vector<std::pair<int, int>> intersections;
+        getPolygonIntersections(intersections, y, vertices);
+        std::sort(intersections.begin(), intersections.end(), [](std::pair<int, int>& a, std::pair<int, int>& b)
+            {
+                return abs(a.first * b.second) < abs(b.first * a.second);
+            });
+
+        for (int i = 0; i < intersections.size(); i += 2) {
+
+            int x_start = intersections[i].first / intersections[i].second;
+            if ( abs((x_start + 1) * intersections[i].second) >= abs(intersections[i].first)) {
+                x_start++;
+            }
+
+            int x_end = intersections[i+1].first / intersections[i+1].second;
+
+            PixelSpan<PixelTraits> pixels = span(y, x_start, x_end);
+            for (int j = 0; j < pixels.size; j++) {
+                pixels.set(j, fill_color);
+            }
+        }
+    }
+}
+
+template <class PixelTraits>
+void ImageView<PixelTraits>::drawPolygon(std::vector<Coord> vertices, int thickness,
+    Color color, bool fill, Color fill_color)
+{
+    if (fill) {
+        fillPolygon(vertices, fill_color);
+    }
+
+    for (int i = 0; i < vertices.size(); i++) {
+        drawLine(vertices[i].x, vertices[i].y, vertices[(i+1)%vertices.size()].x, vertices[(i+1)%vertices.size()].y, thickness, color);
+    }
+}
+
+
+template <class PixelTraits>
+template <class ExecutionPolicy, class Function>
+void ImageView<PixelTraits>::forEachRow(ExecutionPolicy policy, Function function)
+{
+    if (width_ <= 0) {
+        return;
+    }
+    int band_rows = IMAGE_BAND_SIZE / (width_*PixelTraits::pixel_size);
+
+    forEachBand(policy, height_, band_rows, [&](int y0, int y1) {
+        for (int y = y0; y < y1; y++) {
+            function(y, span(y, 0, width_-1));
+        }
+    });
+}
+
+template <class PixelTraits>
+template <class ExecutionPolicy, class Function>
+void ImageView<PixelTraits>::forEachPixel(ExecutionPolicy policy, Function function)
+{
+    forEachRow(policy, [&](int y, PixelSpan<PixelTraits> pixels) {
+        for (int x = 0; x < pixels.size; x++) {
+            function(x, y, pixels.get(x));
+        }
+    });
+}
+
+template <class PixelTraits>
+template <class ExecutionPolicy, class Function>
+void ImageView<PixelTraits>::transformPixels(ExecutionPolicy policy, Function function)
+{
+    forEachRow(policy, [&](int y, PixelSpan<PixelTraits> pixels) {
+        if (ExecutionPolicy::unsequenced) {
+#pragma GCC ivdep
+            for (int x = 0; x < pixels.size; x++) {
+                pixels.set(x, function(pixels.get(x)));
+            }
+        } else {
+            for (int x = 0; x < pixels.size; x++) {
+                pixels.set(x, function(pixels.get(x)));
+            }
+        }
+    });
+}
+
+
+extern template class ImageView<PixelBGR>;
+extern template class ImageView<PixelRGBA>;
+extern template class ImageView<PixelGray>;
+extern template class ImageView<PixelGrayAlpha>;
+extern template class ImageView<PixelRGB>;
+
+}
+#endif
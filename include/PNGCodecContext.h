@@ -0,0 +1,122 @@
+/**
+ * @file PNGCodecContext.h
+ * @brief Header with a description of the PNGCodecContext class (reuse of libpng memmory)
+ * @version 0.1.0
+ * @date 2026-10-17
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+#ifndef PNG_CODEC_CONTEXT_H
+#define PNG_CODEC_CONTEXT_H
+
+#include "BufferPool.h"
+#include <png.h>
+#include <stddef.h>
+#include <vector>
+
+#define PNG_CODEC_CONTEXT_LIMIT      (16*1024*1024)
+#define PNG_CODEC_HEADER_SIZE        16
+#define PNG_CODEC_MIN_BLOCK_SIZE     64
+#define PNG_CODEC_SIZE_CLASSES       32
+
+/**
+ * @brief namespace of ImageEditor.h
+ * 
+ */
+namespace ie
+{
+
+
+/**
+ * @brief Class for reusing libpng and zlib memmory between PNG files<br>
+ * (the libpng structures created by the context take their memmory from its free lists, 
+ * so the zlib windows and the row buffers of one file are given out again for the next one; 
+ * a context is used by one thread at a time and has no locks, see ImagePNG::setCodecContext)
+ * 
+ */
+class PNGCodecContext
+{
+public:
+
+    /**
+     * @brief Construct a new PNGCodecContext object
+     * 
+     * @param[in] limit maximum number of bytes kept in free blocks
+     */
+    explicit PNGCodecContext(size_t limit = PNG_CODEC_CONTEXT_LIMIT);
+
+
+    /**
+     * @brief Destroy the PNGCodecContext object (frees all cached blocks)
+     * 
+     */
+    ~PNGCodecContext();
+
+
+    PNGCodecContext(const PNGCodecContext&) = delete;
+    PNGCodecContext& operator=(const PNGCodecContext&) = delete;
+
+
+    /**
+     * @brief Create a libpng read structure allocating memmory from the context
+     * 
+     * @return png_structp - read structure (NULL if it could not be created)
+     */
+    png_structp createReadStruct();
+
+
+    /**
+     * @brief Create a libpng write structure allocating memmory from the context
+     * 
+     * @return png_structp - write structure (NULL if it could not be created)
+     */
+    png_structp createWriteStruct();
+
+
+    /**
+     * @brief Free all cached blocks
+     * 
+     */
+    void trim();
+
+
+    /**
+     * @brief Get the statistics of the context memmory
+     * 
+     * @return BufferPoolStats - statistics
+     */
+    BufferPoolStats getStats();
+
+
+private:
+
+    std::vector<void*>  free_blocks_[PNG_CODEC_SIZE_CLASSES];
+    size_t              limit_;
+    BufferPoolStats     stats_;
+
+
+    /**
+     * @brief libpng allocation function (mem_ptr is the context)<br>
+     * (blocks are PNG_CODEC_MIN_BLOCK_SIZE << size class bytes, 
+     * the size class is kept in the first PNG_CODEC_HEADER_SIZE bytes)
+     * 
+     * @param[in] png_ptr libpng structure
+     * @param[in] size required size in bytes
+     * @return png_voidp - memmory (NULL if there is not enough memmory)
+     */
+    static png_voidp allocate(png_structp png_ptr, png_alloc_size_t size);
+
+
+    /**
+     * @brief libpng free function returning the block to the context
+     * 
+     * @param[in] png_ptr libpng structure
+     * @param[in] data memmory received from allocate
+     */
+    static void deallocate(png_structp png_ptr, png_voidp data);
+};
+
+}
+#endif
@@ -0,0 +1,212 @@
+/**
+ * @file PixelBuffer.h
+ * @brief Header with a description of the PixelBuffer class
+ * @version 0.1.0
+ * @date 2026-10-17
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+#ifndef PIXEL_BUFFER_H
+#define PIXEL_BUFFER_H
+
+#include "BufferPool.h"
+#include <stddef.h>
+#include <atomic>
+#include <mutex>
+#include <functional>
+
+#define PIXEL_BUFFER_ALIGNMENT        BUFFER_POOL_ALIGNMENT
+
+/**
+ * @brief namespace of ImageEditor.h
+ * 
+ */
+namespace ie
+{
+
+/**
+ * @brief Reference-counted copy-on-write block of pixel data<br>
+ * (copies of a PixelBuffer share the same block until one of them calls detach())
+ * 
+ */
+class PixelBuffer
+{
+public:
+
+    /**
+     * @brief Construct an empty PixelBuffer object
+     * 
+     */
+    PixelBuffer();
+
+
+    /**
+     * @brief Construct a PixelBuffer object sharing the data of other
+     * 
+     * @param[in] other buffer to share
+     */
+    PixelBuffer(const PixelBuffer& other);
+
+
+    /**
+     * @brief Construct a PixelBuffer object taking the data of other
+     * 
+     * @param[in] other buffer to take (becomes empty)
+     */
+    PixelBuffer(PixelBuffer&& other) noexcept;
+
+
+    /**
+     * @brief Destroy the PixelBuffer object (frees the data if it is the last owner)
+     * 
+     */
+    ~PixelBuffer();
+
+
+    /**
+     * @brief Share the data of other
+     * 
+     * @param[in] other buffer to share
+     * @return PixelBuffer& - this buffer
+     */
+    PixelBuffer& operator=(const PixelBuffer& other);
+
+
+    /**
+     * @brief Take the data of other
+     * 
+     * @param[in] other buffer to take (becomes empty)
+     * @return PixelBuffer& - this buffer
+     */
+    PixelBuffer& operator=(PixelBuffer&& other) noexcept;
+
+
+    /**
+     * @brief Allocate a new unshared block (the previous one is released)<br>
+     * (the block is taken from BufferPool::getDefault() and aligned to PIXEL_BUFFER_ALIGNMENT, 
+     * its content is undefined)
+     * 
+     * @param[in] size size of the block in bytes
+     */
+    void allocate(size_t size);
+
+
+    /**
+     * @brief Use a part of a file mapped into memmory as the block (the previous one is released)<br>
+     * (pages are read from the file on first access; the data is not aligned to PIXEL_BUFFER_ALIGNMENT)
+     * 
+     * @param[in] file_name name of the file
+     * @param[in] offset position of the data in the file
+     * @param[in] size size of the data in bytes
+     * @param[in] writable false - the mapping is read-only and detach() copies it before writing<br>
+     * true - the mapping is private copy-on-write, changes are not written to the file
+     * @return true - if the file was mapped
+     * @return false - if the file could not be mapped (the buffer stays empty)
+     */
+    bool mapFile(const char *file_name, size_t offset, size_t size, bool writable);
+
+
+    /**
+     * @brief Create a block that is allocated and filled on the first getData() (the previous one is released)<br>
+     * (copies of the buffer share the block, so the loader is called once)
+     * 
+     * @param[in] size size of the block in bytes
+     * @param[in] loader function writing size bytes of data to the new block
+     */
+    void defer(size_t size, std::function<void(unsigned char *data, size_t size)> loader);
+
+
+    /**
+     * @brief Check if the data of the block is allocated
+     * 
+     * @return true - if the block is not created by defer() or getData() was already called
+     * @return false - if the loader has not been called yet or the buffer is empty
+     */
+    bool isLoaded() const;
+
+
+    /**
+     * @brief Release the block (the buffer becomes empty)
+     * 
+     */
+    void release();
+
+
+    /**
+     * @brief Make the block unshared and writable by copying it if necessary
+     * 
+     * @return true - if the data was copied (pointers into the old block are invalid)
+     * @return false - if the block was already writable
+     */
+    bool detach();
+
+
+    /**
+     * @brief Check if the data can be changed without detach()
+     * 
+     * @return true - if the block is not shared and not a read-only mapping
+     * @return false - otherwise or if the buffer is empty
+     */
+    bool isWritable() const;
+
+
+    /**
+     * @brief Check if the block is used by other buffers
+     * 
+     * @return true - if the block is shared
+     * @return false - if the block is not shared or the buffer is empty
+     */
+    bool isShared() const;
+
+
+    /**
+     * @brief Get the data of the block<br>
+     * (call detach() before writing to it; a block created by defer() is loaded first)
+     * 
+     * @return unsigned char* - pointer to the data (NULL if the buffer is empty)
+     */
+    unsigned char* getData() const;
+
+
+    /**
+     * @brief Get the size of the block
+     * 
+     * @return size_t - size in bytes
+     */
+    size_t getSize() const;
+
+
+private:
+
+    struct Block
+    {
+        std::atomic<int>  ref_count;
+        size_t            size;
+        size_t            capacity;
+        bool              huge_pages;
+        unsigned char     *data;
+        unsigned char     *map_base;
+        size_t            map_length;
+        bool              read_only;
+
+        std::function<void(unsigned char*, size_t)>  loader;
+        std::atomic<bool>                            pending;
+        std::once_flag                               load_once;
+    };
+
+    Block                 *block_;
+
+
+    /**
+     * @brief Create a block with unshared data
+     * 
+     * @param[in] size size of the data in bytes
+     * @return Block* - new block
+     */
+    static Block* createBlock(size_t size);
+};
+
+}
+#endif
@@ -0,0 +1,124 @@
+/**
+ * @file PixelKernels.h
+ * @brief Header with the row kernels of the color processing algorithms
+ * (SSE2, AVX2 and AVX-512 versions chosen by the processor at runtime; 
+ * gray values are computed in fixed point as grayValue in Structures.h)
+ * @version 0.1.0
+ * @date 2026-10-17
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+#ifndef PIXEL_KERNELS_H
+#define PIXEL_KERNELS_H
+
+#include "Structures.h"
+#include <stddef.h>
+
+#define PIXEL_KERNEL_SCALAR             0
+#define PIXEL_KERNEL_SSE2               1
+#define PIXEL_KERNEL_AVX2               2
+#define PIXEL_KERNEL_AVX512             3
+
+#define PIXEL_KERNEL_PATTERN_SIZE       192
+
+/**
+ * @brief namespace of ImageEditor.h
+ * 
+ */
+namespace ie
+{
+
+
+/**
+ * @brief Structure for representing a change of every byte of a row of pixels<br>
+ * (byte i becomes (byte & and_bytes[i % PIXEL_KERNEL_PATTERN_SIZE]) ^ xor_bytes[i % PIXEL_KERNEL_PATTERN_SIZE];
+ * the size is a multiple of pixel sizes 1-4 and of three vectors of each instruction set,
+ * so 24-bit pixels are processed by whole vectors as well)
+ * 
+ */
+struct RowMask
+{
+    unsigned char  and_bytes[PIXEL_KERNEL_PATTERN_SIZE];
+    unsigned char  xor_bytes[PIXEL_KERNEL_PATTERN_SIZE];
+
+    /**
+     * @brief Construct a mask that does not change the bytes
+     * 
+     */
+    RowMask();
+
+
+    /**
+     * @brief Set the change of one byte of every pixel
+     * 
+     * @param[in] pixel_size pixel size in bytes [1..4]
+     * @param[in] offset offset of the byte in the pixel
+     * @param[in] and_byte the byte is ANDed with it first
+     * @param[in] xor_byte the byte is XORed with it then
+     */
+    void setPixelByte(int pixel_size, int offset, unsigned char and_byte, unsigned char xor_byte);
+};
+
+
+/**
+ * @brief Change every byte of a row by the mask
+ * 
+ * @param[in,out] data the first byte of the row (starts with a whole pixel)
+ * @param[in] length row length in bytes
+ * @param[in] mask change of the bytes
+ */
+void applyRowMask(unsigned char *data, size_t length, const RowMask& mask);
+
+
+/**
+ * @brief Convert a row of pixels to gray in place<br>
+ * (the gray value is written to the R, G and B components, the other bytes are kept)
+ * 
+ * @param[in,out] data the first pixel of the row
+ * @param[in] count number of pixels
+ * @param[in] pixel_size pixel size in bytes [1..4]
+ * @param[in] r_offset offset of the R component in the pixel
+ * @param[in] g_offset offset of the G component in the pixel
+ * @param[in] b_offset offset of the B component in the pixel
+ * @param[in] method gray method (format can be: GRAY_BT601, GRAY_BT709, GRAY_AVERAGE or GRAY_LIGHTNESS)
+ */
+void grayRow(unsigned char *data, size_t count, int pixel_size, 
+             int r_offset, int g_offset, int b_offset, int method);
+
+
+/**
+ * @brief Write the gray values of a row of pixels to a row of one-byte pixels
+ * 
+ * @param[in] src the first pixel of the row
+ * @param[out] dst count bytes for the gray values (must not overlap src)
+ * @param[in] count number of pixels
+ * @param[in] pixel_size pixel size in bytes [1..4]
+ * @param[in] r_offset offset of the R component in the pixel
+ * @param[in] g_offset offset of the G component in the pixel
+ * @param[in] b_offset offset of the B component in the pixel
+ * @param[in] method gray method (format can be: GRAY_BT601, GRAY_BT709, GRAY_AVERAGE or GRAY_LIGHTNESS)
+ */
+void grayRowToChannel(const unsigned char *src, unsigned char *dst, size_t count, int pixel_size, 
+                      int r_offset, int g_offset, int b_offset, int method);
+
+
+/**
+ * @brief Get the instruction set used by the row kernels
+ * 
+ * @return int - PIXEL_KERNEL_SCALAR, PIXEL_KERNEL_SSE2, PIXEL_KERNEL_AVX2 or PIXEL_KERNEL_AVX512
+ */
+int getPixelKernelLevel();
+
+
+/**
+ * @brief Limit the instruction set used by the row kernels<br>
+ * (the processor is checked once, the level is not raised above what it supports)
+ * 
+ * @param[in] level PIXEL_KERNEL_SCALAR, PIXEL_KERNEL_SSE2, PIXEL_KERNEL_AVX2 or PIXEL_KERNEL_AVX512
+ */
+void setPixelKernelLevel(int level);
+
+}
+#endif
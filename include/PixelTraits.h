@@ -0,0 +1,232 @@
+/**
+ * @file PixelTraits.h
+ * @brief Header with a description of the pixel formats used by the Image class
+ * @version 0.1.0
+ * @date 2026-10-17
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+#ifndef PIXEL_TRAITS_H
+#define PIXEL_TRAITS_H
+
+#include "Structures.h"
+#include <string.h>
+
+
+/**
+ * @brief namespace of ImageEditor.h
+ * 
+ */
+namespace ie
+{
+
+
+/**
+ * @brief Pixel format 8-bit/color BGR (BMP)<br>
+ * (a pixel is stored in memmory exactly as ColorBGR)
+ * 
+ */
+struct PixelBGR
+{
+    typedef ColorBGR Color;
+
+    static const int   pixel_size = 3;
+    static const int   r_offset   = 2;
+    static const int   g_offset   = 1;
+    static const int   b_offset   = 0;
+    static const int   a_offset   = -1;
+    static const bool  has_alpha  = false;
+
+    /**
+     * @brief Read the pixel color
+     * 
+     * @param[in] pixel pointer to the first byte of the pixel
+     * @return Color - pixel color
+     */
+    static Color load(const unsigned char *pixel)
+    {
+        Color color;
+        memcpy(&color, pixel, pixel_size);
+        return color;
+    }
+
+    /**
+     * @brief Write the pixel color
+     * 
+     * @param[out] pixel pointer to the first byte of the pixel
+     * @param[in] color pixel color
+     */
+    static void store(unsigned char *pixel, Color color)
+    {
+        memcpy(pixel, &color, pixel_size);
+    }
+};
+
+
+/**
+ * @brief Pixel format 8-bit/color RGBA (PNG)<br>
+ * (a pixel is stored in memmory exactly as ColorRGBA)
+ * 
+ */
+struct PixelRGBA
+{
+    typedef ColorRGBA Color;
+
+    static const int   pixel_size = 4;
+    static const int   r_offset   = 0;
+    static const int   g_offset   = 1;
+    static const int   b_offset   = 2;
+    static const int   a_offset   = 3;
+    static const bool  has_alpha  = true;
+
+    /**
+     * @brief Read the pixel color
+     * 
+     * @param[in] pixel pointer to the first byte of the pixel
+     * @return Color - pixel color
+     */
+    static Color load(const unsigned char *pixel)
+    {
+        Color color;
+        memcpy(&color, pixel, pixel_size);
+        return color;
+    }
+
+    /**
+     * @brief Write the pixel color
+     * 
+     * @param[out] pixel pointer to the first byte of the pixel
+     * @param[in] color pixel color
+     */
+    static void store(unsigned char *pixel, Color color)
+    {
+        memcpy(pixel, &color, pixel_size);
+    }
+};
+
+
+/**
+ * @brief Pixel format 8-bit gray (PNG)<br>
+ * (a pixel is one byte, read as an opaque ColorRGBA with equal components; 
+ * only the R component is stored, so the color must be gray)
+ * 
+ */
+struct PixelGray
+{
+    typedef ColorRGBA Color;
+
+    static const int   pixel_size = 1;
+    static const int   r_offset   = 0;
+    static const int   g_offset   = 0;
+    static const int   b_offset   = 0;
+    static const int   a_offset   = -1;
+    static const bool  has_alpha  = false;
+
+    /**
+     * @brief Read the pixel color
+     * 
+     * @param[in] pixel pointer to the first byte of the pixel
+     * @return Color - pixel color
+     */
+    static Color load(const unsigned char *pixel)
+    {
+        return {pixel[0], pixel[0], pixel[0], 255};
+    }
+
+    /**
+     * @brief Write the pixel color
+     * 
+     * @param[out] pixel pointer to the first byte of the pixel
+     * @param[in] color pixel color (gray)
+     */
+    static void store(unsigned char *pixel, Color color)
+    {
+        pixel[0] = color.r;
+    }
+};
+
+
+/**
+ * @brief Pixel format 8-bit gray with alpha (PNG)<br>
+ * (only the R and A components are stored, so the color must be gray)
+ * 
+ */
+struct PixelGrayAlpha
+{
+    typedef ColorRGBA Color;
+
+    static const int   pixel_size = 2;
+    static const int   r_offset   = 0;
+    static const int   g_offset   = 0;
+    static const int   b_offset   = 0;
+    static const int   a_offset   = 1;
+    static const bool  has_alpha  = true;
+
+    /**
+     * @brief Read the pixel color
+     * 
+     * @param[in] pixel pointer to the first byte of the pixel
+     * @return Color - pixel color
+     */
+    static Color load(const unsigned char *pixel)
+    {
+        return {pixel[0], pixel[0], pixel[0], pixel[1]};
+    }
+
+    /**
+     * @brief Write the pixel color
+     * 
+     * @param[out] pixel pointer to the first byte of the pixel
+     * @param[in] color pixel color (gray)
+     */
+    static void store(unsigned char *pixel, Color color)
+    {
+        pixel[0] = color.r;
+        pixel[1] = color.a;
+    }
+};
+
+
+/**
+ * @brief Pixel format 8-bit/color RGB (PNG)<br>
+ * (read as an opaque ColorRGBA, the A component is not stored)
+ * 
+ */
+struct PixelRGB
+{
+    typedef ColorRGBA Color;
+
+    static const int   pixel_size = 3;
+    static const int   r_offset   = 0;
+    static const int   g_offset   = 1;
+    static const int   b_offset   = 2;
+    static const int   a_offset   = -1;
+    static const bool  has_alpha  = false;
+
+    /**
+     * @brief Read the pixel color
+     * 
+     * @param[in] pixel pointer to the first byte of the pixel
+     * @return Color - pixel color
+     */
+    static Color load(const unsigned char *pixel)
+    {
+        return {pixel[0], pixel[1], pixel[2], 255};
+    }
+
+    /**
+     * @brief Write the pixel color
+     * 
+     * @param[out] pixel pointer to the first byte of the pixel
+     * @param[in] color pixel color (opaque)
+     */
+    static void store(unsigned char *pixel, Color color)
+    {
+        memcpy(pixel, &color, pixel_size);
+    }
+};
+
+}
+#endif
@@ -1,6 +1,6 @@
 /**
  * @file Structures.h
- * @brief Header with a description of the Coord and Color structures
+ * @brief Header with a description of the Coord, ImageInfo and Color structures
  * @version 0.1.0
  * @date 2024-05-19
  * 
@@ -16,6 +16,13 @@
 #define B_IDX  2
 #define A_IDX  3
 
+#define GRAY_BT601       0
+#define GRAY_BT709       1
+#define GRAY_AVERAGE     2
+#define GRAY_LIGHTNESS   3
+
+#define GRAY_WEIGHT_BITS 16
+
 
 /**
  * @brief namespace of ImageEditor.h
@@ -36,6 +43,57 @@ struct Coord
 };
 
 
+/**
+ * @brief Structure for representing image file metadata (read without decoding pixels)
+ * 
+ */
+struct ImageInfo
+{
+    int   width;
+    int   height;
+    int   bit_depth;      ///< bits per color component
+    int   channels;       ///< color components per pixel
+    int   color_type;     ///< PNG color type (PNG_COLOR_TYPE_*), BMP files are PNG_COLOR_TYPE_RGB
+    bool  interlaced;
+};
+
+
+/**
+ * @brief Weights of the R, G and B components for the gray methods (except GRAY_LIGHTNESS)<br>
+ * (fixed-point numbers with GRAY_WEIGHT_BITS fraction bits, the weights of a method sum to 1)
+ * 
+ */
+static const int gray_weights[3][3] = {
+    {19595, 38470, 7471},     // GRAY_BT601: 0.299, 0.587, 0.114
+    {13933, 46871, 4732},     // GRAY_BT709: 0.2126, 0.7152, 0.0722
+    {21845, 21846, 21845}     // GRAY_AVERAGE: 1/3
+};
+
+
+/**
+ * @brief Get the gray value of a color
+ * 
+ * @param[in] r R component
+ * @param[in] g G component
+ * @param[in] b B component
+ * @param[in] method gray method (format can be: GRAY_BT601, GRAY_BT709, GRAY_AVERAGE or GRAY_LIGHTNESS)
+ * @return unsigned char - gray value (rounded to the nearest)
+ */
+inline unsigned char grayValue(unsigned char r, unsigned char g, unsigned char b, int method)
+{
+    if (method == GRAY_LIGHTNESS) {
+        int max = r > g ? (r > b ? r : b) : (g > b ? g : b);
+        int min = r < g ? (r < b ? r : b) : (g < b ? g : b);
+        return (max + min + 1) >> 1;
+    }
+    if (method < GRAY_BT601 || method > GRAY_AVERAGE) {
+        method = GRAY_BT601;
+    }
+    const int *weights = gray_weights[method];
+    return (weights[0]*r + weights[1]*g + weights[2]*b + (1 << (GRAY_WEIGHT_BITS-1))) >> GRAY_WEIGHT_BITS;
+}
+
+
 /**
  * @brief Structure for representing pixel color BGR
  * 
@@ -53,7 +111,7 @@ struct ColorBGR
      * @return true - if the same
      * @return false - if not the same
      */
-    bool operator==(ColorBGR other)
+    bool operator==(ColorBGR other) const
     {
         return (b == other.b) && 
                (g == other.g) && 
@@ -68,7 +126,7 @@ struct ColorBGR
      * @return true - if not the same
      * @return false - if the same
      */
-    bool operator!=(ColorBGR other)
+    bool operator!=(ColorBGR other) const
     {
         return !(*this == other);
     }
@@ -88,12 +146,11 @@ struct ColorBGR
     /**
      * @brief convert pixel color to black and white
      * 
+     * @param[in] method gray method (format can be: GRAY_BT601, GRAY_BT709, GRAY_AVERAGE or GRAY_LIGHTNESS)
      */
-    void gray()
+    void gray(int method = GRAY_BT601)
     {
-        b = (0.299 * r) + (0.587 * g) + (0.114 * b);
-        g = (0.299 * r) + (0.587 * g) + (0.114 * b);
-        r = (0.299 * r) + (0.587 * g) + (0.114 * b);
+        b = g = r = grayValue(r, g, b, method);
     }
 };
 
@@ -116,7 +173,7 @@ struct ColorRGBA
      * @return true - if the same
      * @return false - if not the same
      */
-    bool operator==(ColorRGBA other)
+    bool operator==(ColorRGBA other) const
     {
         return (r == other.r) && 
                (g == other.g) && 
@@ -132,7 +189,7 @@ struct ColorRGBA
      * @return true - if not the same
      * @return false - if the same
      */
-    bool operator!=(ColorRGBA other)
+    bool operator!=(ColorRGBA other) const
     {
         return !(*this == other);
     }
@@ -152,12 +209,11 @@ struct ColorRGBA
     /**
      * @brief convert pixel color to black and white
      * 
+     * @param[in] method gray method (format can be: GRAY_BT601, GRAY_BT709, GRAY_AVERAGE or GRAY_LIGHTNESS)
      */
-    void gray()
+    void gray(int method = GRAY_BT601)
     {
-        r = (0.299 * r) + (0.587 * g) + (0.114 * b);
-        g = (0.299 * r) + (0.587 * g) + (0.114 * b);
-        b = (0.299 * r) + (0.587 * g) + (0.114 * b);
+        r = g = b = grayValue(r, g, b, method);
     }
 };
 
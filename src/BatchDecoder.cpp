@@ -0,0 +1,15 @@
+/**
+ * @file BatchDecoder.cpp
+ * @brief Instantiation of the BatchDecoder class template for ImagePNG and ImageBMP
+ * @version 0.1.0
+ * @date 2026-10-17
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+#include "BatchDecoder.h"
+
+
+template class ie::BatchDecoder<ie::ImagePNG>;
+template class ie::BatchDecoder<ie::ImageBMP>;
@@ -0,0 +1,159 @@
+/**
+ * @file BufferPool.cpp
+ * @brief Implementation of the BufferPool class
+ * @version 0.1.0
+ * @date 2026-10-17
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+#include "BufferPool.h"
+#include <stdlib.h>
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
+
+
+ie::BufferPool::BufferPool(size_t limit) :
+    limit_(limit),
+    huge_pages_(false),
+    stats_{0, 0, 0, 0, 0}
+{}
+
+ie::BufferPool::~BufferPool()
+{
+    trim();
+}
+
+ie::BufferPool& ie::BufferPool::getDefault()
+{
+    /* never destroyed, so images with static storage duration can release their blocks at exit */
+    static BufferPool *pool = new BufferPool();
+    return *pool;
+}
+
+size_t ie::BufferPool::getSizeClass(size_t size)
+{
+    if (size <= BUFFER_POOL_MIN_SIZE) {
+        return BUFFER_POOL_MIN_SIZE;
+    }
+
+    size_t power = BUFFER_POOL_MIN_SIZE;
+    while (power*2 < size) {
+        power *= 2;
+    }
+
+    size_t quarter = power / 4;
+    return (size + quarter-1) / quarter * quarter;
+}
+
+void* ie::BufferPool::allocateBlock(size_t capacity, bool huge_pages)
+{
+    if (huge_pages) {
+        void *data = aligned_alloc(BUFFER_POOL_HUGE_PAGE_SIZE, capacity);
+        #ifdef MADV_HUGEPAGE
+        if (data) {
+            madvise(data, capacity, MADV_HUGEPAGE);
+        }
+        #endif
+        return data;
+    }
+    return aligned_alloc(BUFFER_POOL_ALIGNMENT, capacity);
+}
+
+void* ie::BufferPool::acquire(size_t size, size_t *capacity, bool *huge_pages)
+{
+    size_t size_class = getSizeClass(size);
+    bool huge = false;
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (huge_pages_ && size_class >= BUFFER_POOL_HUGE_PAGE_SIZE) {
+            size_class = (size_class + BUFFER_POOL_HUGE_PAGE_SIZE-1) & (-BUFFER_POOL_HUGE_PAGE_SIZE);
+            huge = true;
+        }
+
+        /* huge page blocks are kept apart, so a block of the same size is never given instead */
+        std::map<std::pair<size_t, bool>, std::vector<void*>>::iterator it = free_blocks_.find({size_class, huge});
+        if (it != free_blocks_.end() && !it->second.empty()) {
+            void *data = it->second.back();
+            it->second.pop_back();
+            stats_.hits++;
+            stats_.cached_bytes -= size_class;
+            stats_.in_use_bytes += size_class;
+            *capacity = size_class;
+            *huge_pages = huge;
+            return data;
+        }
+        stats_.misses++;
+    }
+
+    void *data = allocateBlock(size_class, huge);
+    if (!data) {
+        return NULL;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    stats_.in_use_bytes += size_class;
+    stats_.resident_bytes = stats_.in_use_bytes + stats_.cached_bytes;
+    *capacity = size_class;
+    *huge_pages = huge;
+    return data;
+}
+
+void ie::BufferPool::release(void *data, size_t capacity, bool huge_pages)
+{
+    if (!data) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    stats_.in_use_bytes -= capacity;
+    if (stats_.cached_bytes + capacity <= limit_) {
+        free_blocks_[{capacity, huge_pages}].push_back(data);
+        stats_.cached_bytes += capacity;
+    } else {
+        free(data);
+    }
+    stats_.resident_bytes = stats_.in_use_bytes + stats_.cached_bytes;
+}
+
+void ie::BufferPool::shrink(size_t limit)
+{
+    std::map<std::pair<size_t, bool>, std::vector<void*>>::reverse_iterator it = free_blocks_.rbegin();
+    while (stats_.cached_bytes > limit && it != free_blocks_.rend()) {
+        while (stats_.cached_bytes > limit && !it->second.empty()) {
+            free(it->second.back());
+            it->second.pop_back();
+            stats_.cached_bytes -= it->first.first;
+        }
+        it++;
+    }
+    stats_.resident_bytes = stats_.in_use_bytes + stats_.cached_bytes;
+}
+
+void ie::BufferPool::setLimit(size_t limit)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    limit_ = limit;
+    shrink(limit_);
+}
+
+void ie::BufferPool::setHugePages(bool enable)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    huge_pages_ = enable;
+}
+
+void ie::BufferPool::trim()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    shrink(0);
+}
+
+ie::BufferPoolStats ie::BufferPool::getStats()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return stats_;
+}
@@ -0,0 +1,20 @@
+/**
+ * @file Image.cpp
+ * @brief Instantiation of the Image and ImageView class templates for the pixel formats of ImageBMP and ImagePNG
+ * @version 0.1.0
+ * @date 2026-10-17
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+#include "Image.h"
+
+
+template class ie::Image<ie::PixelBGR>;
+template class ie::Image<ie::PixelRGBA>;
+template class ie::ImageView<ie::PixelBGR>;
+template class ie::ImageView<ie::PixelRGBA>;
+template class ie::ImageView<ie::PixelGray>;
+template class ie::ImageView<ie::PixelGrayAlpha>;
+template class ie::ImageView<ie::PixelRGB>;
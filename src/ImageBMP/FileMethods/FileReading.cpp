@@ -12,6 +12,9 @@
 #include "ImageBMP.h"
 #include "Error.h"
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
 
 bool ie::ImageBMP::checkFileValidity()
 {
@@ -21,7 +24,53 @@ bool ie::ImageBMP::checkFileValidity()
 }
 
 
-void ie::ImageBMP::readImageFromFile(const char *input_file_name)
+void ie::ImageBMP::readInfoFields()
+{
+    width_ = dib_header_.width;
+    height_ = abs((int)dib_header_.height);
+    bottom_up_ = ((int)dib_header_.height >= 0);
+}
+
+
+bool ie::ImageBMP::probeFile(const char *input_file_name, ImageInfo& info)
+{
+    FILE *fin = fopen(input_file_name, "rb");
+    if (!fin) {
+        return false;
+    }
+
+    unsigned char headers[sizeof(BMPHeader) + sizeof(DIBHeader)];
+    size_t size = fread(headers, 1, sizeof(headers), fin);
+    fclose(fin);
+    return probeMemory(headers, size, info);
+}
+
+
+bool ie::ImageBMP::probeMemory(const void *data, size_t size, ImageInfo& info)
+{
+    if (size < sizeof(BMPHeader) + sizeof(DIBHeader)) {
+        return false;
+    }
+
+    ImageBMP image;
+    memcpy(&image.bmp_header_, data, sizeof(BMPHeader));
+    memcpy(&image.dib_header_, (const unsigned char*)data + sizeof(BMPHeader), sizeof(DIBHeader));
+    if (!image.checkFileValidity()) {
+        return false;
+    }
+    image.readInfoFields();
+
+    info.width = image.width_;
+    info.height = image.height_;
+    info.bit_depth = BMP_BITS_PER_PIXEL / BMP_CHANNELS;
+    info.channels = BMP_CHANNELS;
+    info.color_type = BMP_COLOR_TYPE;
+    info.interlaced = false;
+    return true;
+}
+
+
+void ie::ImageBMP::readImageFromFile(const char *input_file_name, int read_mode)
 {
     FILE* fin = fopen(input_file_name, "rb");
     
@@ -37,16 +86,81 @@ void ie::ImageBMP::readImageFromFile(const char *input_file_name)
         throwError("Error: wrong file format.", BMP_FILE_ERROR);
     }
     
-    width_ = dib_header_.width;
-    height_ = dib_header_.height;
+    readInfoFields();
 
-    allocateMemmoryForBitmap();
+    if (read_mode == BMP_READ_LAZY) {
+        fclose(fin);
+        deferReading(input_file_name);
+        return;
+    }
+
+    if (read_mode != BMP_READ_COPY) {
+        fclose(fin);
+        if (mapMemmory(input_file_name, bmp_header_.pixel_offset, read_mode == BMP_READ_MAP_PRIVATE)) {
+            return;
+        }
+        fin = fopen(input_file_name, "rb");
+        if (!fin) {
+            throwError("Error: file could not be opened.", BMP_FILE_ERROR);
+        }
+    }
+
+    allocateMemmory();
 
     fseek(fin, bmp_header_.pixel_offset, SEEK_SET);
 
-    for (int y = 0; y < height_; y++) {
-        fread(bitmap_[height_ - y - 1], 1, (width_*sizeof(ColorBGR)+3)&(-4), fin);
-    }
+    fread(buffer_.getData(), 1, buffer_.getSize(), fin);
 
     fclose(fin);
+}
+
+void ie::ImageBMP::deferReading(const char *input_file_name)
+{
+    std::string file_name(input_file_name);
+    long pixel_offset = bmp_header_.pixel_offset;
+
+    freeMemmory();
+    stride_ = rowStride(width_);
+    if (width_ <= 0 || height_ <= 0) {
+        return;
+    }
+
+    buffer_.defer((size_t)stride_*height_, [file_name, pixel_offset](unsigned char *data, size_t size) {
+        FILE *fin = fopen(file_name.c_str(), "rb");
+        if (!fin) {
+            throwError("Error: file could not be opened.", BMP_FILE_ERROR);
+        }
+        fseek(fin, pixel_offset, SEEK_SET);
+        size_t read_size = fread(data, 1, size, fin);
+        fclose(fin);
+        if (read_size != size) {
+            throwError("Error: unexpected end of file.", BMP_FILE_ERROR);
+        }
+    });
+}
+
+void ie::ImageBMP::readImageFromMemory(const void *data, size_t size)
+{
+    const unsigned char *bytes = (const unsigned char*) data;
+
+    if (size < sizeof(BMPHeader) + sizeof(DIBHeader)) {
+        throwError("Error: wrong file format.", BMP_FILE_ERROR);
+    }
+
+    memcpy(&bmp_header_, bytes, sizeof(BMPHeader));
+    memcpy(&dib_header_, bytes + sizeof(BMPHeader), sizeof(DIBHeader));
+
+    if (!checkFileValidity()) {
+        throwError("Error: wrong file format.", BMP_FILE_ERROR);
+    }
+
+    readInfoFields();
+    allocateMemmory();
+
+    if (bmp_header_.pixel_offset > size || buffer_.getSize() > size - bmp_header_.pixel_offset) {
+        freeMemmory();
+        throwError("Error: unexpected end of data.", BMP_FILE_ERROR);
+    }
+
+    memcpy(buffer_.getData(), bytes + bmp_header_.pixel_offset, buffer_.getSize());
 }
\ No newline at end of file
@@ -0,0 +1,92 @@
+/**
+ * @file FileStreaming.cpp
+ * @brief Implementation of band-by-band processing of BMP files
+ * @version 0.1.0
+ * @date 2026-10-17
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+
+#include "ImageBMP.h"
+#include "Error.h"
+#include <stdio.h>
+#include <algorithm>
+
+
+void ie::ImageBMP::processFile(const char *input_file_name, const char *output_file_name, 
+                               const BandCallback& callback, int band_height)
+{
+    if (band_height <= 0) {
+        band_height = BMP_STREAM_BAND_HEIGHT;
+    }
+
+    FILE *fin = fopen(input_file_name, "rb");
+    if (!fin) {
+        throwError("Error: file could not be opened.", BMP_FILE_ERROR);
+    }
+
+    ImageBMP image;
+    if (fread(&image.bmp_header_, sizeof(BMPHeader), 1, fin) != 1 ||
+        fread(&image.dib_header_, sizeof(DIBHeader), 1, fin) != 1 ||
+        !image.checkFileValidity()) {
+        fclose(fin);
+        throwError("Error: wrong file format.", BMP_FILE_ERROR);
+    }
+
+    unsigned int pixel_offset = image.bmp_header_.pixel_offset;
+    image.readInfoFields();
+    image.stride_ = rowStride(image.width_);
+    image.updateHeaders();
+
+    FILE *fout = fopen(output_file_name, "wb");
+    if (!fout) {
+        fclose(fin);
+        throwError("Error: file could not be opened.", BMP_FILE_ERROR);
+    }
+
+    fwrite(&image.bmp_header_, 1, sizeof(BMPHeader), fout);
+    fwrite(&image.dib_header_, 1, sizeof(DIBHeader), fout);
+    fseek(fin, pixel_offset, SEEK_SET);
+
+    int width = image.width_;
+    int height = image.height_;
+    int stride = image.stride_;
+    bool bottom_up = image.bottom_up_;
+
+    PixelBuffer band;
+    if (width > 0 && height > 0) {
+        band.allocate((size_t)stride*std::min(band_height, height));
+    }
+
+    for (int done = 0; done < height && width > 0; ) {
+        int rows = std::min(band_height, height - done);
+        size_t size = (size_t)stride*rows;
+
+        if (fread(band.getData(), 1, size, fin) != size) {
+            fclose(fin);
+            fclose(fout);
+            throwError("Error: unexpected end of file.", BMP_FILE_ERROR);
+        }
+
+        if (bottom_up) {
+            callback(ImageView<PixelBGR>(band.getData() + (size_t)stride*(rows-1), width, rows, -stride), 
+                     height - done - rows);
+        } else {
+            callback(ImageView<PixelBGR>(band.getData(), width, rows, stride), done);
+        }
+
+        if (fwrite(band.getData(), 1, size, fout) != size) {
+            fclose(fin);
+            fclose(fout);
+            throwError("Error: file could not be written.", BMP_FILE_ERROR);
+        }
+        done += rows;
+    }
+
+    fclose(fin);
+    if (fclose(fout) != 0) {
+        throwError("Error: file could not be written.", BMP_FILE_ERROR);
+    }
+}
@@ -12,23 +12,103 @@
 #include "ImageBMP.h"
 #include "Error.h"
 #include <stdio.h>
+#include <string.h>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define BMP_WRITEV
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/uio.h>
+#endif
+
+
+#ifdef BMP_WRITEV
+/**
+ * @brief Write all the parts to the file, repeating the call after a partial write
+ * 
+ * @param[in] fd file descriptor
+ * @param[in] parts parts of the file (changed while writing)
+ * @param[in] count number of the parts
+ * @return true - if everything is written
+ * @return false - if the write failed
+ */
+static bool writeParts(int fd, struct iovec *parts, int count)
+{
+    while (count > 0) {
+        ssize_t written = writev(fd, parts, count);
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return false;
+        }
+        while (count > 0 && static_cast<size_t>(written) >= parts->iov_len) {
+            written -= parts->iov_len;
+            parts++;
+            count--;
+        }
+        if (count > 0) {
+            parts->iov_base = static_cast<char*>(parts->iov_base) + written;
+            parts->iov_len -= written;
+        }
+    }
+    return true;
+}
+#endif
+
 
 void ie::ImageBMP::writeImageToFile(const char *output_file_name)
 {   
+    /* a lazily read image must be read before the output (possibly its own file) is truncated */
+    ensureLoaded();
+    updateHeaders();
+
+    #ifdef BMP_WRITEV
+    int fd = open(output_file_name, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) {
+        throwError("Error: file could not be opened.", BMP_FILE_ERROR);
+    }
+
+    #ifdef __linux__
+    posix_fallocate(fd, 0, bmp_header_.file_size);
+    #endif
+
+    struct iovec parts[3] = {
+        {&bmp_header_, sizeof(BMPHeader)},
+        {&dib_header_, sizeof(DIBHeader)},
+        {buffer_.getData(), buffer_.getSize()}
+    };
+
+    bool written = writeParts(fd, parts, 3);
+    if (close(fd) != 0 || !written) {
+        throwError("Error: file could not be written.", BMP_FILE_ERROR);
+    }
+    #else
     FILE *fout = fopen(output_file_name, "wb");
     if (!fout) {
-        fclose(fout);
         throwError("Error: file could not be opened.", BMP_FILE_ERROR);
     }
 
     fwrite(&bmp_header_, 1, sizeof(BMPHeader), fout);
     fwrite(&dib_header_, 1, sizeof(DIBHeader), fout);
-    
-    fseek(fout, bmp_header_.pixel_offset, SEEK_SET);
-    
-    for (int y = 0; y < height_; y++) {
-        fwrite(bitmap_[height_ - y - 1], 1, (width_*sizeof(ColorBGR)+3)&(-4), fout);
+    fwrite(buffer_.getData(), 1, buffer_.getSize(), fout);
+
+    if (fclose(fout) != 0) {
+        throwError("Error: file could not be written.", BMP_FILE_ERROR);
+    }
+    #endif
+}
+
+
+void ie::ImageBMP::writeImageToBuffer(std::vector<uint8_t>& output_buffer)
+{
+    updateHeaders();
+
+    output_buffer.resize(bmp_header_.file_size);
+    memcpy(output_buffer.data(), &bmp_header_, sizeof(BMPHeader));
+    memcpy(output_buffer.data() + sizeof(BMPHeader), &dib_header_, sizeof(DIBHeader));
+    if (buffer_.getSize() > 0) {
+        memcpy(output_buffer.data() + bmp_header_.pixel_offset, buffer_.getData(), buffer_.getSize());
     }
-    
-    fclose(fout);
-}
\ No newline at end of file
+}
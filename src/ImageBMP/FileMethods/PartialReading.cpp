@@ -0,0 +1,101 @@
+/**
+ * @file PartialReading.cpp
+ * @brief Implementation of methods for reading a reduced image or a part of the image from BMP files
+ * @version 0.1.0
+ * @date 2026-10-17
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+
+#include "ImageBMP.h"
+#include "Error.h"
+#include <stdio.h>
+#include <string.h>
+#include <limits.h>
+#include <vector>
+#include <algorithm>
+#include <utility>
+
+
+void ie::ImageBMP::readPartialImageFromFile(const char *input_file_name, int scale, int x0, int y0, int x1, int y1)
+{
+    FILE* fin = fopen(input_file_name, "rb");
+    if (!fin) {
+        throwError("Error: file could not be opened.", BMP_FILE_ERROR);
+    }
+
+    if (fread(&bmp_header_, sizeof(BMPHeader), 1, fin) != 1 ||
+        fread(&dib_header_, sizeof(DIBHeader), 1, fin) != 1 ||
+        !checkFileValidity()) {
+        fclose(fin);
+        throwError("Error: wrong file format.", BMP_FILE_ERROR);
+    }
+
+    readInfoFields();
+
+    x0 = std::max(x0, 0);
+    y0 = std::max(y0, 0);
+    x1 = std::min(x1, width_ - 1);
+    y1 = std::min(y1, height_ - 1);
+    if (x0 > x1 || y0 > y1) {
+        fclose(fin);
+        throwError("Error: the area is outside the image.", BMP_PROCESSING_ERROR);
+    }
+
+    const int pixel_size = PixelBGR::pixel_size;
+    int full_height = height_;
+    int full_stride = rowStride(width_);
+    width_ = (x1 - x0) / scale + 1;
+    height_ = (y1 - y0) / scale + 1;
+    allocateMemmory();
+
+    std::vector<unsigned char> file_row((size_t)(x1 - x0 + 1)*pixel_size);
+
+    /* only the needed part of the needed rows is read, in the order the rows are stored in the file */
+    for (int i = 0; i < height_; i++) {
+        int y = bottom_up_ ? height_ - 1 - i : i;
+        int full_y = y0 + y*scale;
+        int file_y = bottom_up_ ? full_height - 1 - full_y : full_y;
+        unsigned char *output_row = row(y);
+        unsigned char *input_row = (scale == 1) ? output_row : file_row.data();
+
+        if (fseek(fin, bmp_header_.pixel_offset + (long)file_y*full_stride + (long)x0*pixel_size, SEEK_SET) != 0 ||
+            fread(input_row, 1, file_row.size(), fin) != file_row.size()) {
+            fclose(fin);
+            throwError("Error: unexpected end of file.", BMP_FILE_ERROR);
+        }
+
+        if (scale != 1) {
+            for (int x = 0; x < width_; x++) {
+                memcpy(output_row + x*pixel_size, input_row + (size_t)x*scale*pixel_size, pixel_size);
+            }
+        }
+    }
+
+    fclose(fin);
+}
+
+void ie::ImageBMP::readScaledImageFromFile(const char *input_file_name, int scale)
+{
+    if (scale != 1 && scale != 2 && scale != 4 && scale != 8) {
+        throwError("Error: the scale must be 1, 2, 4 or 8.", BMP_PROCESSING_ERROR);
+    }
+    if (scale == 1) {
+        readImageFromFile(input_file_name);
+        return;
+    }
+    readPartialImageFromFile(input_file_name, scale, 0, 0, INT_MAX, INT_MAX);
+}
+
+void ie::ImageBMP::readAreaFromFile(const char *input_file_name, int x0, int y0, int x1, int y1)
+{
+    if (x0 > x1) {
+        std::swap(x0, x1);
+    }
+    if (y0 > y1) {
+        std::swap(y0, y1);
+    }
+    readPartialImageFromFile(input_file_name, 1, x0, y0, x1, y1);
+}
@@ -1,6 +1,6 @@
 /**
  * @file ImageBMP.cpp
- * @brief Implementation of the class constructor and destructor + showImageInfo method
+ * @brief Implementation of the class constructor + showImageInfo, copy and bgrFilter methods
  * @version 0.1.0
  * @date 2024-05-19
  * 
@@ -14,41 +14,67 @@
 
 
 ie::ImageBMP::ImageBMP() :
+    Image<PixelBGR>(true),
+
     bmp_header_
     {
         BMP_SIGNATURE,
-        static_cast<unsigned char>( (width_*height_)*3+sizeof(bmp_header_)+sizeof(dib_header_) ),
+        sizeof(BMPHeader)+sizeof(DIBHeader),
         0,
         0,
-        sizeof(bmp_header_)+sizeof(dib_header_)
+        sizeof(BMPHeader)+sizeof(DIBHeader)
     },
 
     dib_header_
     {
-        sizeof(dib_header_),
-        static_cast<unsigned int>(width_),
-        static_cast<unsigned int>(height_),
+        sizeof(DIBHeader),
+        0,
+        0,
         1,
         BMP_BITS_PER_PIXEL,
         BMP_COMPRESSION,
-        static_cast<unsigned int>(height_*width_)*3,
+        0,
         0,
         0,
         0,
         0
-    },
-    
-    width_(0),
-    height_(0),
-    bitmap_(NULL)
+    }
 {}
 
-ie::ImageBMP::~ImageBMP()
+void ie::ImageBMP::updateHeaders()
 {
-    freeMemmoryForBitmap();
+    unsigned int image_size = static_cast<unsigned int>(stride_) * static_cast<unsigned int>(height_);
+
+    bmp_header_.signature = BMP_SIGNATURE;
+    bmp_header_.pixel_offset = sizeof(BMPHeader) + sizeof(DIBHeader);
+    bmp_header_.file_size = bmp_header_.pixel_offset + image_size;
+    bmp_header_.reserved1 = 0;
+    bmp_header_.reserved2 = 0;
+
+    dib_header_.byte_count = sizeof(DIBHeader);
+    dib_header_.width = static_cast<unsigned int>(width_);
+    dib_header_.height = static_cast<unsigned int>(bottom_up_ ? height_ : -height_);
+    dib_header_.color_planes = 1;
+    dib_header_.bits_per_pixel = BMP_BITS_PER_PIXEL;
+    dib_header_.compression = BMP_COMPRESSION;
+    dib_header_.image_size = image_size;
+    dib_header_.color_count = 0;
+    dib_header_.important_color_count = 0;
 }
 
 void ie::ImageBMP::showInfo()
 {
     printf("%d x %d, %d-bit/color\n", width_, height_, BMP_BITS_PER_PIXEL);
-}
\ No newline at end of file
+}
+
+ie::ImageBMP ie::ImageBMP::copy(int x0, int y0, int x1, int y1)
+{
+    ImageBMP copy_image;
+    copyArea(copy_image, x0, y0, x1, y1);
+    return copy_image;
+}
+
+void ie::ImageBMP::bgrFilter(int component_idx, unsigned char component_value)
+{
+    componentFilter(component_idx, component_value);
+}
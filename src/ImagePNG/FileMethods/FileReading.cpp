@@ -12,6 +12,10 @@
 #include "ImagePNG.h"
 #include "Error.h"
 #include <png.h>
+#include <stdlib.h>
+#include <string.h>
+#include <zlib.h>
+#include <string>
 
 
 bool ie::ImagePNG::checkFileValidity(FILE *input_file)
@@ -30,10 +34,33 @@ void ie::ImagePNG::readInfoFields()
     interlace_type_      = png_get_interlace_type(png_ptr_, info_ptr_);
     compression_type_    = png_get_compression_type(png_ptr_, info_ptr_);
     filter_type_         = png_get_filter_type(png_ptr_, info_ptr_);
+    pixel_size_          = png_get_channels(png_ptr_, info_ptr_);
 }
 
-void ie::ImagePNG::transformInput()
+void ie::ImagePNG::transformInput(bool to_rgba)
 {
+    palette_.clear();
+
+    if (color_type_ == PNG_COLOR_TYPE_PALETTE && !to_rgba) {
+        png_colorp colors = NULL;
+        int color_count = 0;
+        png_bytep alphas = NULL;
+        int alpha_count = 0;
+        png_get_PLTE(png_ptr_, info_ptr_, &colors, &color_count);
+        if (png_get_valid(png_ptr_, info_ptr_, PNG_INFO_tRNS)) {
+            png_get_tRNS(png_ptr_, info_ptr_, &alphas, &alpha_count, NULL);
+        }
+        for (int i = 0; i < color_count; i++) {
+            palette_.push_back({colors[i].red, colors[i].green, colors[i].blue, 
+                                (unsigned char)(i < alpha_count ? alphas[i] : 255)});
+        }
+        
+        if (bit_depth_ < 8) {
+            png_set_packing(png_ptr_);
+        }
+        return;
+    }
+
     if (color_type_ == PNG_COLOR_TYPE_PALETTE) {
         png_set_palette_to_rgb(png_ptr_);
     }
@@ -50,6 +77,10 @@ void ie::ImagePNG::transformInput()
         png_set_strip_16(png_ptr_);
     }
 
+    if (!to_rgba) {
+        return;
+    }
+
     if (bit_depth_ < 8) {
         png_set_packing(png_ptr_);
     }
@@ -67,72 +98,284 @@ void ie::ImagePNG::transformInput()
     }
 }
 
-void ie::ImagePNG::readImageFromFile(const char *input_file_name)
+const char* ie::ImagePNG::createReadStructs()
 {
-    FILE* fin = fopen(input_file_name, "rb");
-    
-    if (!fin) {
-        throwError("Error: file could not be opened.", PNG_FILE_ERROR);
-    }
-    
-    if (!checkFileValidity(fin)) {
-        fclose(fin);
-        throwError("Error: wrong file format.", PNG_FILE_ERROR);
+    if (codec_context_) {
+        png_ptr_ = codec_context_->createReadStruct();
+    } else {
+        png_ptr_ = png_create_read_struct(PNG_LIBPNG_VER_STRING, NULL, NULL, NULL);
     }
-    
-    png_ptr_ = png_create_read_struct(PNG_LIBPNG_VER_STRING, NULL, NULL, NULL);
     if (!png_ptr_) {
-        fclose(fin);
-        throwError("Error: png_create_read_struct failed.", PNG_PROCESSING_ERROR);
+        return "Error: png_create_read_struct failed.";
     }
 
     info_ptr_ = png_create_info_struct(png_ptr_);
     if (!info_ptr_) {
         png_destroy_read_struct(&png_ptr_, (png_infopp)NULL, (png_infopp)NULL);
-        fclose(fin);
-        throwError("Error: (info_ptr) png_create_info_struct failed.", PNG_PROCESSING_ERROR);
+        return "Error: (info_ptr) png_create_info_struct failed.";
     }
     
     end_info_ptr_ = png_create_info_struct(png_ptr_);
     if (!end_info_ptr_) {
         png_destroy_read_struct(&png_ptr_, &info_ptr_, (png_infopp)NULL);
-        fclose(fin);
-        throwError("Error: (end_info_ptr) png_create_info_struct failed.", PNG_PROCESSING_ERROR);
+        return "Error: (end_info_ptr) png_create_info_struct failed.";
     }
+    return NULL;
+}
 
+const char* ie::ImagePNG::decodeHeader()
+{
     if (setjmp(png_jmpbuf(png_ptr_))) {
         png_destroy_read_struct(&png_ptr_, &info_ptr_, &end_info_ptr_);
-        fclose(fin);
-        throwError("Error: png_init_io failed.", PNG_PROCESSING_ERROR);
+        return "Error: png_read_info failed.";
     }
-    png_init_io(png_ptr_, fin);
 
     png_set_sig_bytes(png_ptr_, PNG_SIG_BYTES);
     png_read_info(png_ptr_, info_ptr_);
     readInfoFields();
-    transformInput();
+    transformInput(false);
     number_of_passes_ = png_set_interlace_handling(png_ptr_);
     png_read_update_info(png_ptr_, info_ptr_);
     readInfoFields();
+    return NULL;
+}
 
+const char* ie::ImagePNG::decodeRows(unsigned char *data)
+{
+    const char *volatile error_message = "Error: png_read_image failed.";
+    png_bytepp volatile row_pointers = NULL;
     if (setjmp(png_jmpbuf(png_ptr_))) {
+        free(row_pointers);
         png_destroy_read_struct(&png_ptr_, &info_ptr_, &end_info_ptr_);
+        return error_message;
+    }
+
+    row_pointers = (png_bytepp) malloc(sizeof(png_bytep) * height_);
+    if (!row_pointers) {
+        png_error(png_ptr_, "not enough memmory for row pointers");
+    }
+    for (int y = 0; y < height_; y++) {
+        row_pointers[y] = data + (size_t)stride_*y;
+    }
+    png_read_image(png_ptr_, row_pointers);
+    free(row_pointers);
+    row_pointers = NULL;
+
+    error_message = "Error: png_read_end failed.";
+
+    png_read_end(png_ptr_, end_info_ptr_);
+    png_destroy_read_struct(&png_ptr_, &info_ptr_, &end_info_ptr_);
+    return NULL;
+}
+
+const char* ie::ImagePNG::decodeImage()
+{
+    const char *error_message = decodeHeader();
+    if (error_message) {
+        return error_message;
+    }
+
+    allocateNativeMemmory();
+    return decodeRows(buffer_.getData());
+}
+
+void ie::ImagePNG::deferDecoding(const char *input_file_name)
+{
+    freeMemmory();
+    stride_ = nativeRowStride();
+    if (width_ <= 0 || height_ <= 0) {
+        return;
+    }
+
+    /* the loader keeps the format of the image without its pixel data */
+    ImagePNG header_image(*this);
+    header_image.codec_context_ = NULL;
+    std::string file_name(input_file_name);
+
+    buffer_.defer((size_t)stride_*height_, [header_image, file_name](unsigned char *data, size_t size) mutable {
+        header_image.decodeDeferred(file_name.c_str(), data, size);
+    });
+}
+
+void ie::ImagePNG::decodeDeferred(const char *input_file_name, unsigned char *data, size_t size)
+{
+    int width = width_;
+    int height = height_;
+    int color_type = color_type_;
+
+    FILE* fin = fopen(input_file_name, "rb");
+    if (!fin) {
+        throwError("Error: file could not be opened.", PNG_FILE_ERROR);
+    }
+    if (!checkFileValidity(fin)) {
         fclose(fin);
-        throwError("Error: png_read_image failed.", PNG_PROCESSING_ERROR);
+        throwError("Error: wrong file format.", PNG_FILE_ERROR);
     }
 
-    allocateMemmoryForRowPointers();
-    clear();
+    const char *error_message = createReadStructs();
+    if (error_message) {
+        fclose(fin);
+        throwError(error_message, PNG_PROCESSING_ERROR);
+    }
 
-    png_read_image(png_ptr_, row_pointers_);
+    png_init_io(png_ptr_, fin);
 
-    if (setjmp(png_jmpbuf(png_ptr_))) {
+    error_message = decodeHeader();
+    if (!error_message && (width_ != width || height_ != height || color_type_ != color_type)) {
         png_destroy_read_struct(&png_ptr_, &info_ptr_, &end_info_ptr_);
+        error_message = "Error: the file was changed after reading the header.";
+    }
+    if (!error_message) {
+        memset(data, 0, size);
+        error_message = decodeRows(data);
+    }
+    fclose(fin);
+    if (error_message) {
+        throwError(error_message, PNG_PROCESSING_ERROR);
+    }
+}
+
+/**
+ * @brief Data source of readImageFromMemory
+ * 
+ */
+struct PNGMemoryReader
+{
+    const unsigned char  *data;
+    size_t                size;
+    size_t                offset;
+};
+
+/**
+ * @brief libpng read function taking the data from PNGMemoryReader
+ * 
+ * @param[in] png_ptr read structure (io_ptr is PNGMemoryReader)
+ * @param[out] data read bytes
+ * @param[in] length number of bytes to read
+ */
+static void readFromMemory(png_structp png_ptr, png_bytep data, png_size_t length)
+{
+    PNGMemoryReader *reader = (PNGMemoryReader*) png_get_io_ptr(png_ptr);
+    if (length > reader->size - reader->offset) {
+        png_error(png_ptr, "unexpected end of data");
+    }
+    memcpy(data, reader->data + reader->offset, length);
+    reader->offset += length;
+}
+
+bool ie::ImagePNG::probeFile(const char *input_file_name, ImageInfo& info)
+{
+    FILE *fin = fopen(input_file_name, "rb");
+    if (!fin) {
+        return false;
+    }
+
+    png_byte header[PNG_PROBE_BYTES];
+    size_t size = fread(header, 1, PNG_PROBE_BYTES, fin);
+    fclose(fin);
+    return probeMemory(header, size, info);
+}
+
+bool ie::ImagePNG::probeMemory(const void *data, size_t size, ImageInfo& info)
+{
+    /* signature (8 bytes), IHDR length and type (8 bytes), IHDR data (13 bytes), CRC (4 bytes) */
+    png_const_bytep bytes = (png_const_bytep) data;
+    if (size < PNG_PROBE_BYTES || 
+        png_sig_cmp(bytes, 0, PNG_SIG_BYTES) != 0 || 
+        png_get_uint_32(bytes + 8) != 13 || 
+        memcmp(bytes + 12, "IHDR", 4) != 0 || 
+        crc32(crc32(0, NULL, 0), bytes + 12, 17) != png_get_uint_32(bytes + 29)) {
+        return false;
+    }
+
+    png_uint_32 width = png_get_uint_32(bytes + 16);
+    png_uint_32 height = png_get_uint_32(bytes + 20);
+    int bit_depth = bytes[24];
+    int color_type = bytes[25];
+    int interlace_type = bytes[28];
+
+    int channels = 0;
+    switch (color_type) {
+        case PNG_COLOR_TYPE_GRAY:        channels = 1; break;
+        case PNG_COLOR_TYPE_GRAY_ALPHA:  channels = 2; break;
+        case PNG_COLOR_TYPE_RGB:         channels = 3; break;
+        case PNG_COLOR_TYPE_RGB_ALPHA:   channels = 4; break;
+        case PNG_COLOR_TYPE_PALETTE:     channels = 1; break;
+        default:                         return false;
+    }
+
+    if (width == 0 || height == 0 || width > PNG_UINT_31_MAX || height > PNG_UINT_31_MAX || 
+        (bit_depth != 1 && bit_depth != 2 && bit_depth != 4 && bit_depth != 8 && bit_depth != 16) || 
+        interlace_type > PNG_INTERLACE_ADAM7) {
+        return false;
+    }
+
+    info.width = width;
+    info.height = height;
+    info.bit_depth = bit_depth;
+    info.channels = channels;
+    info.color_type = color_type;
+    info.interlaced = (interlace_type == PNG_INTERLACE_ADAM7);
+    return true;
+}
+
+void ie::ImagePNG::readImageFromFile(const char *input_file_name, int read_mode)
+{
+    FILE* fin = fopen(input_file_name, "rb");
+    
+    if (!fin) {
+        throwError("Error: file could not be opened.", PNG_FILE_ERROR);
+    }
+    
+    if (!checkFileValidity(fin)) {
         fclose(fin);
-        throwError("Error: png_read_end failed.", PNG_PROCESSING_ERROR);
+        throwError("Error: wrong file format.", PNG_FILE_ERROR);
+    }
+    
+    const char *error_message = createReadStructs();
+    if (error_message) {
+        fclose(fin);
+        throwError(error_message, PNG_PROCESSING_ERROR);
     }
 
-    png_read_end(png_ptr_, end_info_ptr_);
-    png_destroy_read_struct(&png_ptr_, &info_ptr_, &end_info_ptr_);
+    png_init_io(png_ptr_, fin);
+
+    if (read_mode == PNG_READ_LAZY) {
+        error_message = decodeHeader();
+        if (!error_message) {
+            png_destroy_read_struct(&png_ptr_, &info_ptr_, &end_info_ptr_);
+        }
+        fclose(fin);
+        if (error_message) {
+            throwError(error_message, PNG_PROCESSING_ERROR);
+        }
+        deferDecoding(input_file_name);
+        return;
+    }
+
+    error_message = decodeImage();
     fclose(fin);
-}
\ No newline at end of file
+    if (error_message) {
+        throwError(error_message, PNG_PROCESSING_ERROR);
+    }
+}
+
+void ie::ImagePNG::readImageFromMemory(const void *data, size_t size)
+{
+    if (size < PNG_SIG_BYTES || png_sig_cmp((png_const_bytep)data, 0, PNG_SIG_BYTES) != 0) {
+        throwError("Error: wrong file format.", PNG_FILE_ERROR);
+    }
+
+    const char *error_message = createReadStructs();
+    if (error_message) {
+        throwError(error_message, PNG_PROCESSING_ERROR);
+    }
+
+    PNGMemoryReader reader = {(const unsigned char*)data, size, PNG_SIG_BYTES};
+    png_set_read_fn(png_ptr_, &reader, readFromMemory);
+
+    error_message = decodeImage();
+    if (error_message) {
+        throwError(error_message, PNG_PROCESSING_ERROR);
+    }
+}
@@ -0,0 +1,144 @@
+/**
+ * @file FileStreaming.cpp
+ * @brief Implementation of row-by-row processing of PNG files
+ * @version 0.1.0
+ * @date 2026-10-17
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+
+#include "ImagePNG.h"
+#include "Error.h"
+#include <png.h>
+#include <stdio.h>
+
+
+void ie::ImagePNG::processFile(const char *input_file_name, const char *output_file_name, 
+                               const std::vector<RowCallback>& operations, 
+                               const PNGEncodeOptions& options)
+{
+    ImagePNG image;
+
+    FILE *fin = fopen(input_file_name, "rb");
+    if (!fin) {
+        throwError("Error: file could not be opened.", PNG_FILE_ERROR);
+    }
+
+    if (!image.checkFileValidity(fin)) {
+        fclose(fin);
+        throwError("Error: wrong file format.", PNG_FILE_ERROR);
+    }
+
+    FILE *fout = fopen(output_file_name, "wb");
+    if (!fout) {
+        fclose(fin);
+        throwError("Error: file could not be opened.", PNG_FILE_ERROR);
+    }
+
+    png_structp read_ptr = png_create_read_struct(PNG_LIBPNG_VER_STRING, NULL, NULL, NULL);
+    png_infop read_info_ptr = read_ptr ? png_create_info_struct(read_ptr) : NULL;
+    png_structp write_ptr = png_create_write_struct(PNG_LIBPNG_VER_STRING, NULL, NULL, NULL);
+    png_infop write_info_ptr = write_ptr ? png_create_info_struct(write_ptr) : NULL;
+
+    if (!read_info_ptr || !write_info_ptr) {
+        png_destroy_read_struct(&read_ptr, &read_info_ptr, (png_infopp)NULL);
+        png_destroy_write_struct(&write_ptr, &write_info_ptr);
+        fclose(fin);
+        fclose(fout);
+        throwError("Error: png_create_struct failed.", PNG_PROCESSING_ERROR);
+    }
+
+    if (setjmp(png_jmpbuf(read_ptr))) {
+        png_destroy_read_struct(&read_ptr, &read_info_ptr, (png_infopp)NULL);
+        png_destroy_write_struct(&write_ptr, &write_info_ptr);
+        fclose(fin);
+        fclose(fout);
+        throwError("Error: png_read_row failed.", PNG_PROCESSING_ERROR);
+    }
+
+    if (setjmp(png_jmpbuf(write_ptr))) {
+        png_destroy_read_struct(&read_ptr, &read_info_ptr, (png_infopp)NULL);
+        png_destroy_write_struct(&write_ptr, &write_info_ptr);
+        fclose(fin);
+        fclose(fout);
+        throwError("Error: png_write_row failed.", PNG_PROCESSING_ERROR);
+    }
+
+    image.png_ptr_ = read_ptr;
+    image.info_ptr_ = read_info_ptr;
+
+    png_init_io(read_ptr, fin);
+    png_set_sig_bytes(read_ptr, PNG_SIG_BYTES);
+    png_read_info(read_ptr, read_info_ptr);
+    image.readInfoFields();
+
+    if (image.interlace_type_ != PNG_INTERLACE_NONE) {
+        png_destroy_read_struct(&read_ptr, &read_info_ptr, (png_infopp)NULL);
+        png_destroy_write_struct(&write_ptr, &write_info_ptr);
+        fclose(fin);
+        fclose(fout);
+
+        /* the same RGBA output as the row by row path, which can not use these settings */
+        PNGEncodeOptions whole_options = options;
+        whole_options.auto_color_type = false;
+        whole_options.threads = 1;
+
+        ImagePNG whole_image;
+        whole_image.readImageFromFile(input_file_name);
+        whole_image.setEncodeOptions(whole_options);
+        ImageView<PixelRGBA> view = whole_image.view();
+        for (int y = 0; y < view.getHeight(); y++) {
+            for (const RowCallback& operation : operations) {
+                operation(view.subView(0, y, view.getWidth()-1, y), y);
+            }
+        }
+        whole_image.writeImageToFile(output_file_name);
+        return;
+    }
+
+    image.transformInput(true);
+    png_read_update_info(read_ptr, read_info_ptr);
+    image.readInfoFields();
+
+    png_init_io(write_ptr, fout);
+    applyEncodeOptions(write_ptr, options);
+    png_set_IHDR(
+        write_ptr, 
+        write_info_ptr, 
+        image.width_, 
+        image.height_, 
+        8, 
+        PNG_COLOR_TYPE_RGBA,
+        PNG_INTERLACE_NONE, 
+        PNG_COMPRESSION_TYPE_DEFAULT, 
+        PNG_FILTER_TYPE_DEFAULT
+    );
+    png_write_info(write_ptr, write_info_ptr);
+
+    image.height_ = 1;
+    image.allocateMemmory();
+    ImageView<PixelRGBA> row_view = image.view();
+    int height = png_get_image_height(read_ptr, read_info_ptr);
+
+    for (int y = 0; y < height; y++) {
+        png_read_row(read_ptr, row_view.row(0), NULL);
+        for (const RowCallback& operation : operations) {
+            operation(row_view, y);
+        }
+        png_write_row(write_ptr, row_view.row(0));
+    }
+
+    png_read_end(read_ptr, NULL);
+    png_write_end(write_ptr, NULL);
+
+    image.png_ptr_ = NULL;
+    image.info_ptr_ = NULL;
+    png_destroy_read_struct(&read_ptr, &read_info_ptr, (png_infopp)NULL);
+    png_destroy_write_struct(&write_ptr, &write_info_ptr);
+    fclose(fin);
+    if (fclose(fout) != 0) {
+        throwError("Error: file could not be written.", PNG_FILE_ERROR);
+    }
+}
@@ -12,45 +12,46 @@
 #include "ImagePNG.h"
 #include "Error.h"
 #include <png.h>
+#include <stdlib.h>
 
-void ie::ImagePNG::writeImageToFile(const char *output_file_name)
-{   
-    FILE *fout = fopen(output_file_name, "wb");
-    if (!fout) {
-        fclose(fout);
-        throwError("Error: file could not be opened.", PNG_FILE_ERROR);
+const char* ie::ImagePNG::createWriteStructs()
+{
+    if (codec_context_) {
+        png_ptr_ = codec_context_->createWriteStruct();
+    } else {
+        png_ptr_ = png_create_write_struct(PNG_LIBPNG_VER_STRING, NULL, NULL, NULL);
     }
-
-    png_structp png_ptr_ = png_create_write_struct(PNG_LIBPNG_VER_STRING, NULL, NULL, NULL);
-
     if (!png_ptr_) {
-        fclose(fout);
-        throwError("Error: png_create_write_struct failed.", PNG_PROCESSING_ERROR);
+        return "Error: png_create_write_struct failed.";
     }
     
-    png_infop info_ptr_ = png_create_info_struct(png_ptr_);
-
+    info_ptr_ = png_create_info_struct(png_ptr_);
     if (!info_ptr_) {
-        png_destroy_info_struct(png_ptr_, (png_infopp)NULL);
-        fclose(fout);
-        throwError("Error: (info_ptr) png_create_info_struct failed.", PNG_PROCESSING_ERROR);
-    }
-
-    if (setjmp(png_jmpbuf(png_ptr_))) {
-        png_destroy_info_struct(png_ptr_, &info_ptr_);
-        fclose(fout);
-        throwError("Error: png_init_io failed.", PNG_PROCESSING_ERROR);
+        png_destroy_write_struct(&png_ptr_, (png_infopp)NULL);
+        return "Error: (info_ptr) png_create_info_struct failed.";
     }
-    
-    png_init_io(png_ptr_, fout);
+    return NULL;
+}
 
+void ie::ImagePNG::applyEncodeOptions(png_structp png_ptr, const PNGEncodeOptions& options)
+{
+    png_set_compression_level(png_ptr, options.compression_level);
+    png_set_compression_strategy(png_ptr, options.strategy);
+    png_set_filter(png_ptr, PNG_FILTER_TYPE_BASE, options.filters);
+    png_set_compression_buffer_size(png_ptr, options.buffer_size);
+}
 
+const char* ie::ImagePNG::encodeImage()
+{
+    const char *volatile error_message = "Error: png_set_IHDR failed.";
+    png_bytepp volatile row_pointers = NULL;
     if (setjmp(png_jmpbuf(png_ptr_))) {
-        png_destroy_info_struct(png_ptr_, &info_ptr_);
-        fclose(fout);
-        throwError("Error: png_set_IHDR failed.", PNG_PROCESSING_ERROR);
+        free(row_pointers);
+        png_destroy_write_struct(&png_ptr_, &info_ptr_);
+        return error_message;
     }
 
+    applyEncodeOptions(png_ptr_, encode_options_);
     png_set_IHDR(
         png_ptr_, 
         info_ptr_, 
@@ -62,26 +63,151 @@ void ie::ImagePNG::writeImageToFile(const char *output_file_name)
         compression_type_, 
         filter_type_
     );
+
+    if (color_type_ == PNG_COLOR_TYPE_PALETTE) {
+        png_color colors[PNG_MAX_PALETTE_LENGTH];
+        png_byte alphas[PNG_MAX_PALETTE_LENGTH];
+        int alpha_count = 0;
+        for (size_t i = 0; i < palette_.size(); i++) {
+            colors[i] = {palette_[i].r, palette_[i].g, palette_[i].b};
+            alphas[i] = palette_[i].a;
+            if (alphas[i] != 255) {
+                alpha_count = i + 1;
+            }
+        }
+        png_set_PLTE(png_ptr_, info_ptr_, colors, palette_.size());
+        if (alpha_count > 0) {
+            png_set_tRNS(png_ptr_, info_ptr_, alphas, alpha_count, NULL);
+        }
+    }
     
     png_write_info(png_ptr_, info_ptr_);
 
-    if (setjmp(png_jmpbuf(png_ptr_))) {
-        png_destroy_info_struct(png_ptr_, &info_ptr_);
-        fclose(fout);
-        throwError("Error: png_write_image failed.", PNG_PROCESSING_ERROR);
-    }
+    error_message = "Error: png_write_image failed.";
     
-    png_write_image(png_ptr_, row_pointers_);
+    row_pointers = createRowPointers();
+    png_write_image(png_ptr_, row_pointers);
+    free(row_pointers);
+    row_pointers = NULL;
 
-    if (setjmp(png_jmpbuf(png_ptr_))) {
-        png_destroy_info_struct(png_ptr_, &info_ptr_);
-        fclose(fout);
-        throwError("Error: png_write_end failed.", PNG_PROCESSING_ERROR);
-    }
+    error_message = "Error: png_write_end failed.";
 
     png_write_end(png_ptr_, NULL);
     
     png_destroy_write_struct(&png_ptr_, &info_ptr_);
+    return NULL;
+}
+
+/**
+ * @brief libpng write function appending the data to a std::vector<uint8_t>
+ * 
+ * @param[in] png_ptr write structure (io_ptr is the vector)
+ * @param[in] data written bytes
+ * @param[in] length number of bytes to write
+ */
+static void writeToBuffer(png_structp png_ptr, png_bytep data, png_size_t length)
+{
+    std::vector<uint8_t> *buffer = (std::vector<uint8_t>*) png_get_io_ptr(png_ptr);
+    buffer->insert(buffer->end(), data, data + length);
+}
 
-    fclose(fout);
-}
\ No newline at end of file
+/**
+ * @brief libpng flush function of writeToBuffer (nothing to flush)
+ * 
+ * @param[in] png_ptr write structure
+ */
+static void flushBuffer(png_structp png_ptr)
+{
+    (void) png_ptr;
+}
+
+bool ie::ImagePNG::useParallelEncoder()
+{
+    return encode_options_.threads != 1 && 
+           width_ > 0 && height_ > 0 && 
+           bit_depth_ == 8 && 
+           interlace_type_ == PNG_INTERLACE_NONE;
+}
+
+void ie::ImagePNG::writeImageToFile(const char *output_file_name)
+{   
+    /* a lazily decoded image must be decoded before the output (possibly its own file) is truncated */
+    ensureLoaded();
+    if (encode_options_.auto_color_type) {
+        ImagePNG minimal_image(*this);
+        minimal_image.encode_options_.auto_color_type = false;
+        if (minimal_image.minimizePixelFormat()) {
+            minimal_image.writeImageToFile(output_file_name);
+            return;
+        }
+    }
+
+    FILE *fout = fopen(output_file_name, "wb");
+    if (!fout) {
+        throwError("Error: file could not be opened.", PNG_FILE_ERROR);
+    }
+
+    if (useParallelEncoder()) {
+        std::vector<uint8_t> output_buffer;
+        const char *error_message = encodeImageParallel(output_buffer);
+        if (error_message) {
+            fclose(fout);
+            throwError(error_message, PNG_PROCESSING_ERROR);
+        }
+        size_t written = fwrite(output_buffer.data(), 1, output_buffer.size(), fout);
+        if (fclose(fout) != 0 || written != output_buffer.size()) {
+            throwError("Error: file could not be written.", PNG_FILE_ERROR);
+        }
+        return;
+    }
+
+    const char *error_message = createWriteStructs();
+    if (error_message) {
+        fclose(fout);
+        throwError(error_message, PNG_PROCESSING_ERROR);
+    }
+
+    png_init_io(png_ptr_, fout);
+
+    error_message = encodeImage();
+    if (fclose(fout) != 0 && !error_message) {
+        error_message = "Error: file could not be written.";
+    }
+    if (error_message) {
+        throwError(error_message, PNG_PROCESSING_ERROR);
+    }
+}
+
+void ie::ImagePNG::writeImageToBuffer(std::vector<uint8_t>& output_buffer)
+{
+    output_buffer.clear();
+
+    if (encode_options_.auto_color_type) {
+        ImagePNG minimal_image(*this);
+        minimal_image.encode_options_.auto_color_type = false;
+        if (minimal_image.minimizePixelFormat()) {
+            minimal_image.writeImageToBuffer(output_buffer);
+            return;
+        }
+    }
+
+    if (useParallelEncoder()) {
+        const char *error_message = encodeImageParallel(output_buffer);
+        if (error_message) {
+            throwError(error_message, PNG_PROCESSING_ERROR);
+        }
+        return;
+    }
+
+    const char *error_message = createWriteStructs();
+    if (error_message) {
+        throwError(error_message, PNG_PROCESSING_ERROR);
+    }
+
+    png_set_write_fn(png_ptr_, &output_buffer, writeToBuffer, flushBuffer);
+
+    error_message = encodeImage();
+    if (error_message) {
+        throwError(error_message, PNG_PROCESSING_ERROR);
+    }
+}
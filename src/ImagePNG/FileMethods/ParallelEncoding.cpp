@@ -0,0 +1,308 @@
+/**
+ * @file ParallelEncoding.cpp
+ * @brief Implementation of the multithreaded PNG encoder<br>
+ * (row blocks are filtered and deflated independently and joined into one zlib stream)
+ * @version 0.1.0
+ * @date 2026-10-17
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+
+#include "ImagePNG.h"
+#include "Error.h"
+#include <png.h>
+#include <zlib.h>
+#include <stdlib.h>
+#include <string.h>
+#include <atomic>
+#include <thread>
+#include <algorithm>
+
+
+/**
+ * @brief Predictor of the PAETH filter
+ * 
+ */
+static unsigned char paethPredictor(int a, int b, int c)
+{
+    int p = a + b - c;
+    int pa = abs(p - a);
+    int pb = abs(p - b);
+    int pc = abs(p - c);
+    if (pa <= pb && pa <= pc) {
+        return a;
+    }
+    return (pb <= pc) ? b : c;
+}
+
+/**
+ * @brief Apply one PNG filter to the row
+ * 
+ * @param[in] type filter type (PNG_FILTER_VALUE_*)
+ * @param[in] row row bytes
+ * @param[in] prev bytes of the previous row (NULL for the first row)
+ * @param[in] length row size in bytes
+ * @param[in] bpp pixel size in bytes
+ * @param[out] out filtered row (length bytes)
+ */
+static void applyFilter(int type, const unsigned char *row, const unsigned char *prev, 
+                        size_t length, int bpp, unsigned char *out)
+{
+    size_t first = std::min<size_t>(bpp, length);
+
+    if (!prev && (type == PNG_FILTER_VALUE_UP || type == PNG_FILTER_VALUE_NONE)) {
+        memcpy(out, row, length);
+        return;
+    }
+
+    switch (type) {
+        case PNG_FILTER_VALUE_SUB:
+            memcpy(out, row, first);
+            for (size_t i = first; i < length; i++) {
+                out[i] = row[i] - row[i-bpp];
+            }
+            break;
+
+        case PNG_FILTER_VALUE_UP:
+            for (size_t i = 0; i < length; i++) {
+                out[i] = row[i] - prev[i];
+            }
+            break;
+
+        case PNG_FILTER_VALUE_AVG:
+            for (size_t i = 0; i < first; i++) {
+                out[i] = row[i] - ((prev ? prev[i] : 0) >> 1);
+            }
+            for (size_t i = first; i < length; i++) {
+                out[i] = row[i] - ((row[i-bpp] + (prev ? prev[i] : 0)) >> 1);
+            }
+            break;
+
+        case PNG_FILTER_VALUE_PAETH:
+            if (!prev) {
+                /* with the zero previous row PAETH is the same as SUB */
+                applyFilter(PNG_FILTER_VALUE_SUB, row, prev, length, bpp, out);
+                break;
+            }
+            for (size_t i = 0; i < first; i++) {
+                out[i] = row[i] - prev[i];
+            }
+            for (size_t i = first; i < length; i++) {
+                out[i] = row[i] - paethPredictor(row[i-bpp], prev[i], prev[i-bpp]);
+            }
+            break;
+
+        default:
+            memcpy(out, row, length);
+            break;
+    }
+}
+
+/**
+ * @brief Filter the row with the best of the allowed filters<br>
+ * (the filter with the minimum sum of absolute values is chosen, as libpng does)
+ * 
+ * @param[in] row row bytes
+ * @param[in] prev bytes of the previous row (NULL for the first row)
+ * @param[in] length row size in bytes
+ * @param[in] bpp pixel size in bytes
+ * @param[in] filters allowed filters (PNG_FILTER_* flags)
+ * @param[out] out filter type and the filtered row (length + 1 bytes)
+ * @param[out] scratch temporary memmory (length bytes)
+ */
+static void filterRow(const unsigned char *row, const unsigned char *prev, size_t length, 
+                      int bpp, int filters, unsigned char *out, unsigned char *scratch)
+{
+    filters &= PNG_ALL_FILTERS;
+    if (filters == 0) {
+        filters = PNG_FILTER_NONE;
+    }
+
+    unsigned long best_sum = ~0UL;
+    for (int type = PNG_FILTER_VALUE_NONE; type < PNG_FILTER_VALUE_LAST; type++) {
+        int flag = PNG_FILTER_NONE << type;
+        if (!(filters & flag)) {
+            continue;
+        }
+        if (filters == flag) {
+            out[0] = type;
+            applyFilter(type, row, prev, length, bpp, out + 1);
+            return;
+        }
+
+        applyFilter(type, row, prev, length, bpp, scratch);
+        unsigned long sum = 0;
+        for (size_t i = 0; i < length && sum < best_sum; i++) {
+            sum += abs((signed char)scratch[i]);
+        }
+        if (sum < best_sum) {
+            best_sum = sum;
+            out[0] = type;
+            memcpy(out + 1, scratch, length);
+        }
+    }
+}
+
+/**
+ * @brief Append a PNG chunk to the data
+ * 
+ * @param[out] output PNG data
+ * @param[in] type chunk type (4 letters)
+ * @param[in] data chunk data
+ * @param[in] length chunk data size in bytes
+ */
+static void appendChunk(std::vector<uint8_t>& output, const char *type, 
+                        const unsigned char *data, size_t length)
+{
+    unsigned char header[8];
+    png_save_uint_32(header, (png_uint_32)length);
+    memcpy(header + 4, type, 4);
+
+    unsigned long crc = crc32(0, header + 4, 4);
+    if (length > 0) {
+        crc = crc32(crc, data, (uInt)length);
+    }
+    unsigned char footer[4];
+    png_save_uint_32(footer, (png_uint_32)crc);
+
+    output.insert(output.end(), header, header + 8);
+    output.insert(output.end(), data, data + length);
+    output.insert(output.end(), footer, footer + 4);
+}
+
+
+const char* ie::ImagePNG::encodeImageParallel(std::vector<uint8_t>& output_buffer)
+{
+    const int bpp = pixel_size_;
+    const size_t row_length = (size_t)width_*bpp;
+    const size_t filtered_length = row_length + 1;
+    const int block_rows = (int)std::max<size_t>(1, PNG_PARALLEL_BLOCK_SIZE / filtered_length);
+    const int block_count = (height_ + block_rows - 1) / block_rows;
+    const int dictionary_rows = (int)((PNG_DEFLATE_WINDOW + filtered_length - 1) / filtered_length);
+
+    int thread_count = encode_options_.threads;
+    if (thread_count <= 0) {
+        thread_count = std::max(1u, std::thread::hardware_concurrency());
+    }
+    thread_count = std::min(thread_count, block_count);
+
+    std::vector<std::vector<uint8_t>> blocks(block_count);
+    std::vector<unsigned long> checksums(block_count);
+    std::atomic<int> next_block(0);
+    std::atomic<bool> failed(false);
+
+    auto worker = [&]() {
+        std::vector<unsigned char> filtered;
+        std::vector<unsigned char> scratch(row_length);
+
+        for (int b = next_block++; b < block_count && !failed; b = next_block++) {
+            int y0 = b*block_rows;
+            int y1 = std::min(height_, y0 + block_rows);
+            int d0 = std::max(0, y0 - dictionary_rows);
+
+            /* the rows before the block are filtered again to give the same dictionary as in one stream */
+            filtered.resize(filtered_length*(y1 - d0));
+            for (int y = d0; y < y1; y++) {
+                filterRow(row(y), y > 0 ? row(y-1) : NULL, row_length, bpp, encode_options_.filters, 
+                          filtered.data() + filtered_length*(y - d0), scratch.data());
+            }
+            const unsigned char *data = filtered.data() + filtered_length*(y0 - d0);
+            size_t length = filtered_length*(y1 - y0);
+            size_t dictionary_length = std::min<size_t>(filtered_length*(y0 - d0), PNG_DEFLATE_WINDOW);
+
+            z_stream stream;
+            memset(&stream, 0, sizeof(stream));
+            if (deflateInit2(&stream, encode_options_.compression_level, Z_DEFLATED, -MAX_WBITS, 
+                             8, encode_options_.strategy) != Z_OK) {
+                failed = true;
+                break;
+            }
+            if (dictionary_length > 0) {
+                deflateSetDictionary(&stream, data - dictionary_length, (uInt)dictionary_length);
+            }
+
+            bool last = (b == block_count - 1);
+            std::vector<uint8_t>& block = blocks[b];
+            block.resize(deflateBound(&stream, length) + 16);
+            stream.next_in = (Bytef*)data;
+            stream.avail_in = (uInt)length;
+            stream.next_out = block.data();
+            stream.avail_out = (uInt)block.size();
+
+            int result = deflate(&stream, last ? Z_FINISH : Z_SYNC_FLUSH);
+            if ((last ? result != Z_STREAM_END : result != Z_OK) || stream.avail_in != 0) {
+                failed = true;
+            }
+            block.resize(stream.total_out);
+            deflateEnd(&stream);
+
+            checksums[b] = adler32(adler32(0, NULL, 0), data, (uInt)length);
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (int i = 1; i < thread_count; i++) {
+        threads.emplace_back(worker);
+    }
+    worker();
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    if (failed) {
+        return "Error: parallel deflate failed.";
+    }
+
+    output_buffer.clear();
+    static const unsigned char signature[PNG_SIG_BYTES] = {137, 80, 78, 71, 13, 10, 26, 10};
+    output_buffer.insert(output_buffer.end(), signature, signature + PNG_SIG_BYTES);
+
+    unsigned char ihdr[13];
+    png_save_uint_32(ihdr, width_);
+    png_save_uint_32(ihdr + 4, height_);
+    ihdr[8] = 8;
+    ihdr[9] = color_type_;
+    ihdr[10] = PNG_COMPRESSION_TYPE_BASE;
+    ihdr[11] = PNG_FILTER_TYPE_BASE;
+    ihdr[12] = PNG_INTERLACE_NONE;
+    appendChunk(output_buffer, "IHDR", ihdr, sizeof(ihdr));
+
+    if (color_type_ == PNG_COLOR_TYPE_PALETTE) {
+        std::vector<unsigned char> plte, trns;
+        for (const ColorRGBA& color : palette_) {
+            plte.insert(plte.end(), {color.r, color.g, color.b});
+            trns.push_back(color.a);
+        }
+        while (!trns.empty() && trns.back() == 255) {
+            trns.pop_back();
+        }
+        appendChunk(output_buffer, "PLTE", plte.data(), plte.size());
+        if (!trns.empty()) {
+            appendChunk(output_buffer, "tRNS", trns.data(), trns.size());
+        }
+    }
+
+    /* zlib header: 32K window, FLEVEL from the compression level, FCHECK makes it divisible by 31 */
+    int level = encode_options_.compression_level;
+    int flevel = (level < 0) ? 2 : (level < 2) ? 0 : (level < 6) ? 1 : (level == 6) ? 2 : 3;
+    unsigned char zlib_header[2] = {0x78, (unsigned char)(flevel << 6)};
+    zlib_header[1] += (31 - (zlib_header[0]*256 + zlib_header[1]) % 31) % 31;
+    blocks.front().insert(blocks.front().begin(), zlib_header, zlib_header + 2);
+
+    unsigned long checksum = checksums[0];
+    for (int b = 1; b < block_count; b++) {
+        size_t length = filtered_length*(std::min(height_, (b + 1)*block_rows) - b*block_rows);
+        checksum = adler32_combine(checksum, checksums[b], (z_off_t)length);
+    }
+    unsigned char zlib_footer[4];
+    png_save_uint_32(zlib_footer, (png_uint_32)checksum);
+    blocks.back().insert(blocks.back().end(), zlib_footer, zlib_footer + 4);
+
+    for (const std::vector<uint8_t>& block : blocks) {
+        appendChunk(output_buffer, "IDAT", block.data(), block.size());
+    }
+    appendChunk(output_buffer, "IEND", NULL, 0);
+    return NULL;
+}
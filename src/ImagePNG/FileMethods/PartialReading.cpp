@@ -0,0 +1,176 @@
+/**
+ * @file PartialReading.cpp
+ * @brief Implementation of methods for reading a reduced image or a part of the image from PNG files
+ * @version 0.1.0
+ * @date 2026-10-17
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+
+#include "ImagePNG.h"
+#include "Error.h"
+#include <png.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <algorithm>
+#include <utility>
+
+
+const char* ie::ImagePNG::decodePartialImage(int scale, int x0, int y0, int x1, int y1)
+{
+    const char *volatile error_message = "Error: png_read_info failed.";
+    png_bytep volatile decoded_row = NULL;
+    if (setjmp(png_jmpbuf(png_ptr_))) {
+        free(decoded_row);
+        png_destroy_read_struct(&png_ptr_, &info_ptr_, &end_info_ptr_);
+        return error_message;
+    }
+
+    png_set_sig_bytes(png_ptr_, PNG_SIG_BYTES);
+    png_read_info(png_ptr_, info_ptr_);
+    readInfoFields();
+    transformInput(false);
+    png_read_update_info(png_ptr_, info_ptr_);
+    readInfoFields();
+
+    /* the clipped area is kept in new variables, the arguments are not changed after setjmp */
+    const int left = std::max(x0, 0);
+    const int top = std::max(y0, 0);
+    const int right = std::min(x1, width_ - 1);
+    const int bottom = std::min(y1, height_ - 1);
+    if (left > right || top > bottom) {
+        png_destroy_read_struct(&png_ptr_, &info_ptr_, &end_info_ptr_);
+        return "Error: the area is outside the image.";
+    }
+
+    error_message = "Error: png_read_row failed.";
+
+    const int pixel_size = pixel_size_;
+    int full_width = width_;
+    int full_height = height_;
+    width_ = (right - left) / scale + 1;
+    height_ = (bottom - top) / scale + 1;
+    allocateNativeMemmory();
+
+    decoded_row = (png_bytep) malloc(png_get_rowbytes(png_ptr_, info_ptr_));
+    if (!decoded_row) {
+        png_error(png_ptr_, "not enough memmory for a row");
+    }
+
+    bool read_all = true;
+
+    if (interlace_type_ == PNG_INTERLACE_NONE) {
+        number_of_passes_ = 1;
+        read_all = (bottom == full_height - 1);
+
+        /* the rows after the area are not decoded */
+        for (int y = 0; y <= bottom; y++) {
+            png_read_row(png_ptr_, decoded_row, NULL);
+            if (y < top || (y - top) % scale != 0) {
+                continue;
+            }
+            unsigned char *output_row = row((y - top) / scale);
+            for (int x = 0; x < width_; x++) {
+                memcpy(output_row + x*pixel_size, decoded_row + (size_t)(left + x*scale)*pixel_size, pixel_size);
+            }
+        }
+    } else {
+        /* the pixels of every 8th, 4th and 2nd row and column are complete after passes 1, 3 and 5 */
+        int last_pass = PNG_INTERLACE_ADAM7_PASSES - 1;
+        if (left % scale == 0 && top % scale == 0) {
+            last_pass = (scale == 8) ? 0 : (scale == 4) ? 2 : (scale == 2) ? 4 : last_pass;
+        }
+        number_of_passes_ = last_pass + 1;
+
+        /* the passes after last_pass are not decoded, the image starts cleared */
+        if (last_pass < PNG_INTERLACE_ADAM7_PASSES - 1) {
+            Image::clear();
+        }
+
+        for (int pass = 0; pass <= last_pass; pass++) {
+            int pass_width = PNG_PASS_COLS(full_width, pass);
+            int pass_height = PNG_PASS_ROWS(full_height, pass);
+            if (pass_width == 0 || pass_height == 0) {
+                continue;
+            }
+
+            for (int pass_y = 0; pass_y < pass_height; pass_y++) {
+                int y = PNG_ROW_FROM_PASS_ROW(pass_y, pass);
+                if (pass == last_pass && y > bottom) {
+                    break;
+                }
+                png_read_row(png_ptr_, decoded_row, NULL);
+                if (y < top || y > bottom || (y - top) % scale != 0) {
+                    continue;
+                }
+                unsigned char *output_row = row((y - top) / scale);
+                for (int pass_x = 0; pass_x < pass_width; pass_x++) {
+                    int x = PNG_COL_FROM_PASS_COL(pass_x, pass);
+                    if (x >= left && x <= right && (x - left) % scale == 0) {
+                        memcpy(output_row + ((x - left) / scale)*pixel_size, decoded_row + pass_x*pixel_size, pixel_size);
+                    }
+                }
+            }
+        }
+        read_all = (last_pass == PNG_INTERLACE_ADAM7_PASSES - 1 && bottom == full_height - 1);
+    }
+
+    free(decoded_row);
+    decoded_row = NULL;
+
+    if (read_all) {
+        error_message = "Error: png_read_end failed.";
+        png_read_end(png_ptr_, end_info_ptr_);
+    }
+    png_destroy_read_struct(&png_ptr_, &info_ptr_, &end_info_ptr_);
+    return NULL;
+}
+
+void ie::ImagePNG::readPartialImageFromFile(const char *input_file_name, int scale, int x0, int y0, int x1, int y1)
+{
+    FILE* fin = fopen(input_file_name, "rb");
+    if (!fin) {
+        throwError("Error: file could not be opened.", PNG_FILE_ERROR);
+    }
+    
+    if (!checkFileValidity(fin)) {
+        fclose(fin);
+        throwError("Error: wrong file format.", PNG_FILE_ERROR);
+    }
+    
+    const char *error_message = createReadStructs();
+    if (error_message) {
+        fclose(fin);
+        throwError(error_message, PNG_PROCESSING_ERROR);
+    }
+
+    png_init_io(png_ptr_, fin);
+
+    error_message = decodePartialImage(scale, x0, y0, x1, y1);
+    fclose(fin);
+    if (error_message) {
+        throwError(error_message, PNG_PROCESSING_ERROR);
+    }
+}
+
+void ie::ImagePNG::readScaledImageFromFile(const char *input_file_name, int scale)
+{
+    if (scale != 1 && scale != 2 && scale != 4 && scale != 8) {
+        throwError("Error: the scale must be 1, 2, 4 or 8.", PNG_PROCESSING_ERROR);
+    }
+    readPartialImageFromFile(input_file_name, scale, 0, 0, INT_MAX, INT_MAX);
+}
+
+void ie::ImagePNG::readAreaFromFile(const char *input_file_name, int x0, int y0, int x1, int y1)
+{
+    if (x0 > x1) {
+        std::swap(x0, x1);
+    }
+    if (y0 > y1) {
+        std::swap(y0, y1);
+    }
+    readPartialImageFromFile(input_file_name, 1, x0, y0, x1, y1);
+}
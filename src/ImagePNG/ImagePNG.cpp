@@ -1,6 +1,6 @@
 /**
  * @file ImagePNG.cpp
- * @brief Implementation of the class constructor and destructor + showImageInfo method
+ * @brief Implementation of the class constructor + showImageInfo and rgbaFilter methods
  * @version 0.1.0
  * @date 2024-05-19
  * 
@@ -9,31 +9,60 @@
  */
 
 #include "ImagePNG.h"
+#include "Error.h"
 #include <stdlib.h>
 
 
 ie::ImagePNG::ImagePNG() :
-    pixel_size_         (4),
+    Image<PixelRGBA>    (false),
     png_ptr_            (NULL),
     info_ptr_           (NULL),
     end_info_ptr_       (NULL),
-    width_              (0),
-    height_             (0),
     bit_depth_          (8),
     color_type_         (PNG_COLOR_TYPE_RGBA),
     interlace_type_     (PNG_INTERLACE_NONE),
     compression_type_   (PNG_COMPRESSION_TYPE_DEFAULT),
     filter_type_        (PNG_FILTER_TYPE_DEFAULT),
     number_of_passes_   (0),
-    row_pointers_       (NULL)
+    pixel_size_         (PixelRGBA::pixel_size),
+    palette_            (),
+    encode_options_     (),
+    codec_context_      (NULL)
 {}
 
-ie::ImagePNG::~ImagePNG()
+void ie::ImagePNG::showInfo()
 {
-    freeMemmoryForRowPointers();
+    printf("%d x %d, %d-bit/color, color type - %d\n", width_, height_, bit_depth_, color_type_);
 }
 
-void ie::ImagePNG::showInfo()
+void ie::ImagePNG::setEncodeOptions(const PNGEncodeOptions& options)
 {
-    printf("%d x %d, %d-bit/color, color type - %d\n", width_, height_, bit_depth_, color_type_);
-}
\ No newline at end of file
+    encode_options_ = options;
+}
+
+ie::PNGEncodeOptions ie::ImagePNG::getEncodeOptions()
+{
+    return encode_options_;
+}
+
+void ie::ImagePNG::setCodecContext(PNGCodecContext *context)
+{
+    codec_context_ = context;
+}
+
+void ie::ImagePNG::rgbaFilter(int component_idx, unsigned char component_value)
+{
+    componentFilter(component_idx, component_value);
+}
+
+png_bytepp ie::ImagePNG::createRowPointers()
+{
+    png_bytepp row_pointers = (png_bytepp) malloc(sizeof(png_bytep) * height_);
+    if (!row_pointers) {
+        throwError("Error: not enough memmory for row pointers.", PNG_PROCESSING_ERROR);
+    }
+    for (int y = 0; y < height_; y++) {
+        row_pointers[y] = row(y);
+    }
+    return row_pointers;
+}
@@ -0,0 +1,108 @@
+/**
+ * @file PNGCodecContext.cpp
+ * @brief Implementation of the PNGCodecContext class
+ * @version 0.1.0
+ * @date 2026-10-17
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+#include "PNGCodecContext.h"
+#include <stdlib.h>
+
+
+ie::PNGCodecContext::PNGCodecContext(size_t limit) :
+    limit_(limit),
+    stats_{0, 0, 0, 0, 0}
+{}
+
+ie::PNGCodecContext::~PNGCodecContext()
+{
+    trim();
+}
+
+png_structp ie::PNGCodecContext::createReadStruct()
+{
+    return png_create_read_struct_2(PNG_LIBPNG_VER_STRING, NULL, NULL, NULL, 
+                                    this, allocate, deallocate);
+}
+
+png_structp ie::PNGCodecContext::createWriteStruct()
+{
+    return png_create_write_struct_2(PNG_LIBPNG_VER_STRING, NULL, NULL, NULL, 
+                                     this, allocate, deallocate);
+}
+
+void ie::PNGCodecContext::trim()
+{
+    for (int size_class = 0; size_class < PNG_CODEC_SIZE_CLASSES; size_class++) {
+        for (void *block : free_blocks_[size_class]) {
+            free(block);
+        }
+        free_blocks_[size_class].clear();
+    }
+    stats_.resident_bytes -= stats_.cached_bytes;
+    stats_.cached_bytes = 0;
+}
+
+ie::BufferPoolStats ie::PNGCodecContext::getStats()
+{
+    return stats_;
+}
+
+png_voidp ie::PNGCodecContext::allocate(png_structp png_ptr, png_alloc_size_t size)
+{
+    PNGCodecContext *context = (PNGCodecContext*) png_get_mem_ptr(png_ptr);
+
+    int size_class = 0;
+    while (size_class < PNG_CODEC_SIZE_CLASSES && 
+           ((size_t)PNG_CODEC_MIN_BLOCK_SIZE << size_class) < size + PNG_CODEC_HEADER_SIZE) {
+        size_class++;
+    }
+    if (size_class == PNG_CODEC_SIZE_CLASSES) {
+        return NULL;
+    }
+    size_t capacity = (size_t)PNG_CODEC_MIN_BLOCK_SIZE << size_class;
+
+    unsigned char *block = NULL;
+    std::vector<void*>& free_blocks = context->free_blocks_[size_class];
+    if (!free_blocks.empty()) {
+        block = (unsigned char*) free_blocks.back();
+        free_blocks.pop_back();
+        context->stats_.hits++;
+        context->stats_.cached_bytes -= capacity;
+    } else {
+        block = (unsigned char*) malloc(capacity);
+        if (!block) {
+            return NULL;
+        }
+        context->stats_.misses++;
+        context->stats_.resident_bytes += capacity;
+    }
+    context->stats_.in_use_bytes += capacity;
+
+    *(int*)block = size_class;
+    return block + PNG_CODEC_HEADER_SIZE;
+}
+
+void ie::PNGCodecContext::deallocate(png_structp png_ptr, png_voidp data)
+{
+    if (!data) {
+        return;
+    }
+    PNGCodecContext *context = (PNGCodecContext*) png_get_mem_ptr(png_ptr);
+
+    unsigned char *block = (unsigned char*)data - PNG_CODEC_HEADER_SIZE;
+    int size_class = *(int*)block;
+    size_t capacity = (size_t)PNG_CODEC_MIN_BLOCK_SIZE << size_class;
+    context->stats_.in_use_bytes -= capacity;
+
+    if (context->stats_.cached_bytes + capacity > context->limit_) {
+        free(block);
+        context->stats_.resident_bytes -= capacity;
+        return;
+    }
+    context->free_blocks_[size_class].push_back(block);
+    context->stats_.cached_bytes += capacity;
+}
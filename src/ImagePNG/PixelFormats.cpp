@@ -0,0 +1,662 @@
+/**
+ * @file PixelFormats.cpp
+ * @brief Implementation of the methods working with the pixel formats of PNG images
+ * @version 0.1.0
+ * @date 2026-10-17
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+#include "ImagePNG.h"
+#include <stdint.h>
+#include <string.h>
+#include <utility>
+
+
+/**
+ * @brief Hash set of up to PNG_MAX_PALETTE_LENGTH colors numbered in the order of adding<br>
+ * (open addressing in a table twice as large as the palette)
+ * 
+ */
+struct PaletteTable
+{
+    static const int table_bits = 9;
+    static const int table_size = 1 << table_bits;
+
+    uint32_t                    keys[table_size];
+    int                         indices[table_size];    // -1 - empty slot
+    std::vector<ie::ColorRGBA>  colors;
+
+    PaletteTable()
+    {
+        memset(indices, -1, sizeof(indices));
+    }
+
+    /**
+     * @brief Find the number of the color
+     * 
+     * @param[in] color color
+     * @param[in] add add the color if it is not found and the table is not full
+     * @return int - number of the color or -1 if there is no such color
+     */
+    int find(ie::ColorRGBA color, bool add)
+    {
+        uint32_t key = color.r | (color.g << 8) | (color.b << 16) | ((uint32_t)color.a << 24);
+        int slot = (key * 2654435761u) >> (32 - table_bits);
+
+        while (indices[slot] >= 0) {
+            if (keys[slot] == key) {
+                return indices[slot];
+            }
+            slot = (slot + 1) & (table_size - 1);
+        }
+
+        if (!add || colors.size() >= PNG_MAX_PALETTE_LENGTH) {
+            return -1;
+        }
+        keys[slot] = key;
+        indices[slot] = colors.size();
+        colors.push_back(color);
+        return indices[slot];
+    }
+};
+
+
+/*
+ * Pixel formats (gray, gray with alpha, RGB, palette, RGBA)
+ */
+
+int ie::ImagePNG::getPixelSize()
+{
+    return pixel_size_;
+}
+
+int ie::ImagePNG::getColorType()
+{
+    return color_type_;
+}
+
+void ie::ImagePNG::setPixelFormat(int color_type)
+{
+    bit_depth_ = 8;
+    color_type_ = color_type;
+
+    switch (color_type) {
+        case PNG_COLOR_TYPE_GRAY:
+        case PNG_COLOR_TYPE_PALETTE:
+            pixel_size_ = PixelGray::pixel_size;
+            break;
+        case PNG_COLOR_TYPE_GRAY_ALPHA:
+            pixel_size_ = PixelGrayAlpha::pixel_size;
+            break;
+        case PNG_COLOR_TYPE_RGB:
+            pixel_size_ = PixelRGB::pixel_size;
+            break;
+        default:
+            pixel_size_ = PixelRGBA::pixel_size;
+            break;
+    }
+}
+
+int ie::ImagePNG::nativeRowStride()
+{
+    return (width_*pixel_size_ + IMAGE_ROW_ALIGNMENT-1) & (-IMAGE_ROW_ALIGNMENT);
+}
+
+void ie::ImagePNG::allocateNativeMemmory()
+{
+    freeMemmory();
+
+    stride_ = nativeRowStride();
+    if (width_ <= 0 || height_ <= 0) {
+        return;
+    }
+
+    buffer_.allocate((size_t)stride_*height_);
+}
+
+void ie::ImagePNG::convertToRGBA()
+{
+    if (color_type_ == PNG_COLOR_TYPE_RGBA) {
+        return;
+    }
+
+    ImagePNG src_image(*this);
+    setPixelFormat(PNG_COLOR_TYPE_RGBA);
+    allocateMemmory();
+
+    ImageView<PixelRGBA> dst_view = Image::constView();
+    src_image.forNativeView(false, [&](auto src_view) {
+        for (int y = 0; y < height_; y++) {
+            for (int x = 0; x < width_; x++) {
+                dst_view.setAt(x, y, src_image.fromNativeColor(src_view.at(x, y)));
+            }
+        }
+    });
+
+    palette_.clear();
+}
+
+bool ie::ImagePNG::minimizePixelFormat()
+{
+    if (width_ <= 0 || height_ <= 0) {
+        return false;
+    }
+
+    bool opaque = true;
+    bool gray = true;
+    bool few_colors = true;
+    PaletteTable table;
+
+    forNativeView(false, [&](auto view) {
+        for (int y = 0; y < height_ && (opaque || gray || few_colors); y++) {
+            for (int x = 0; x < width_; x++) {
+                Color color = fromNativeColor(view.at(x, y));
+                opaque = opaque && color.a == 255;
+                gray = gray && color.r == color.g && color.g == color.b;
+                few_colors = few_colors && table.find(color, true) >= 0;
+            }
+        }
+    });
+
+    int color_type = PNG_COLOR_TYPE_RGBA;
+    if (gray && opaque) {
+        color_type = PNG_COLOR_TYPE_GRAY;
+    } else if (few_colors) {
+        color_type = PNG_COLOR_TYPE_PALETTE;
+    } else if (gray) {
+        color_type = PNG_COLOR_TYPE_GRAY_ALPHA;
+    } else if (opaque) {
+        color_type = PNG_COLOR_TYPE_RGB;
+    }
+
+    /* transparent colors go first to shorten the tRNS chunk */
+    std::vector<Color> palette;
+    std::vector<unsigned char> palette_indices(table.colors.size());
+    if (color_type == PNG_COLOR_TYPE_PALETTE) {
+        for (bool transparent : {true, false}) {
+            for (size_t i = 0; i < table.colors.size(); i++) {
+                if ((table.colors[i].a != 255) == transparent) {
+                    palette_indices[i] = palette.size();
+                    palette.push_back(table.colors[i]);
+                }
+            }
+        }
+    }
+
+    /* the same palette gives the same indices, so the image would not change */
+    if (color_type == color_type_ && (color_type != PNG_COLOR_TYPE_PALETTE || palette == palette_)) {
+        return false;
+    }
+
+    ImagePNG src_image(*this);
+    setPixelFormat(color_type);
+    allocateNativeMemmory();
+    palette_ = palette;
+
+    src_image.forNativeView(false, [&](auto src_view) {
+        forNativeView(true, [&](auto dst_view) {
+            for (int y = 0; y < height_; y++) {
+                for (int x = 0; x < width_; x++) {
+                    Color color = src_image.fromNativeColor(src_view.at(x, y));
+                    if (color_type == PNG_COLOR_TYPE_PALETTE) {
+                        unsigned char i = palette_indices[table.find(color, false)];
+                        color = {i, i, i, 255};
+                    }
+                    dst_view.setAt(x, y, color);
+                }
+            }
+        });
+    });
+    return true;
+}
+
+void ie::ImagePNG::convertToGray(int method)
+{
+    if (color_type_ == PNG_COLOR_TYPE_GRAY || color_type_ == PNG_COLOR_TYPE_GRAY_ALPHA) {
+        return;
+    }
+
+    /* palette images need the alpha only if some palette color is transparent */
+    bool alpha = (color_type_ == PNG_COLOR_TYPE_RGBA);
+    if (color_type_ == PNG_COLOR_TYPE_PALETTE) {
+        for (ColorRGBA color : palette_) {
+            alpha = alpha || color.a != 255;
+        }
+        convertToRGBA();
+    }
+
+    ImagePNG src_image(*this);
+    setPixelFormat(alpha ? PNG_COLOR_TYPE_GRAY_ALPHA : PNG_COLOR_TYPE_GRAY);
+    allocateNativeMemmory();
+
+    src_image.forNativeView(false, [&](auto src_view) {
+        if (!alpha) {
+            src_view.grayToChannel(ImageView<PixelGray>(buffer_.getData(), width_, height_, stride_), method);
+            return;
+        }
+
+        /* the gray values of a row are interleaved with the alpha */
+        std::vector<unsigned char> gray_row(width_);
+        ImageView<PixelGrayAlpha> dst_view(buffer_.getData(), width_, height_, stride_);
+        for (int y = 0; y < height_; y++) {
+            src_view.subView(0, y, width_-1, y).grayToChannel(ImageView<PixelGray>(gray_row.data(), width_, 1, 0), method);
+            for (int x = 0; x < width_; x++) {
+                unsigned char value = gray_row[x];
+                dst_view.setAt(x, y, {value, value, value, src_view.at(x, y).a});
+            }
+        }
+    });
+}
+
+bool ie::ImagePNG::toNativeColor(Color color, Color *native_color, bool add_to_palette)
+{
+    bool is_gray = (color.r == color.g && color.g == color.b);
+    *native_color = color;
+
+    switch (color_type_) {
+        case PNG_COLOR_TYPE_GRAY:
+            return is_gray && color.a == 255;
+        case PNG_COLOR_TYPE_GRAY_ALPHA:
+            return is_gray;
+        case PNG_COLOR_TYPE_RGB:
+            return color.a == 255;
+        case PNG_COLOR_TYPE_PALETTE:
+            break;
+        default:
+            return true;
+    }
+
+    size_t index = 0;
+    while (index < palette_.size() && palette_[index] != color) {
+        index++;
+    }
+    if (index == palette_.size()) {
+        if (!add_to_palette || palette_.size() >= PNG_MAX_PALETTE_LENGTH) {
+            return false;
+        }
+        palette_.push_back(color);
+    }
+
+    unsigned char i = index;
+    *native_color = {i, i, i, 255};
+    return true;
+}
+
+ie::ImagePNG::Color ie::ImagePNG::fromNativeColor(Color native_color)
+{
+    if (color_type_ != PNG_COLOR_TYPE_PALETTE) {
+        return native_color;
+    }
+    if (native_color.r >= palette_.size()) {
+        return {0, 0, 0, 255};
+    }
+    return palette_[native_color.r];
+}
+
+bool ie::ImagePNG::isPaletteUnique()
+{
+    for (size_t i = 0; i < palette_.size(); i++) {
+        for (size_t j = i+1; j < palette_.size(); j++) {
+            if (palette_[i] == palette_[j]) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+
+/*
+ * Pixel access and views
+ */
+
+ie::ImagePNG::Color ie::ImagePNG::getColor(int x, int y)
+{
+    if (x < 0 || x >= width_ || y < 0 || y >= height_) {
+        return Color();
+    }
+
+    Color native_color;
+    forNativeView(false, [&](auto view) { native_color = view.getColor(x, y); });
+    return fromNativeColor(native_color);
+}
+
+void ie::ImagePNG::setColor(int x, int y, Color color)
+{
+    if (x < 0 || x >= width_ || y < 0 || y >= height_) {
+        return;
+    }
+
+    Color native_color;
+    if (!toNativeColor(color, &native_color, true)) {
+        convertToRGBA();
+        Image::setColor(x, y, color);
+        return;
+    }
+    forNativeView(true, [&](auto view) { view.setColor(x, y, native_color); });
+}
+
+ie::ImageView<ie::PixelRGBA> ie::ImagePNG::view()
+{
+    convertToRGBA();
+    return Image::view();
+}
+
+ie::ImageView<ie::PixelRGBA> ie::ImagePNG::view(int x0, int y0, int x1, int y1)
+{
+    convertToRGBA();
+    return Image::view(x0, y0, x1, y1);
+}
+
+ie::ImageView<ie::PixelRGBA> ie::ImagePNG::constView()
+{
+    convertToRGBA();
+    return Image::constView();
+}
+
+ie::ImageView<ie::PixelRGBA> ie::ImagePNG::constView(int x0, int y0, int x1, int y1)
+{
+    convertToRGBA();
+    return Image::constView(x0, y0, x1, y1);
+}
+
+
+/*
+ * Process shape (setSize, resize, copy, paste, rotate, reflect)
+ */
+
+void ie::ImagePNG::setSize(int width, int height)
+{
+    setPixelFormat(PNG_COLOR_TYPE_RGBA);
+    palette_.clear();
+    Image::setSize(width, height);
+}
+
+void ie::ImagePNG::resize(int x0, int y0, int new_width, int new_height)
+{
+    convertToRGBA();
+    Image::resize(x0, y0, new_width, new_height);
+}
+
+ie::ImagePNG ie::ImagePNG::copy(int x0, int y0, int x1, int y1)
+{
+    if (x0 > x1) {
+        std::swap(x0, x1);
+    }
+    if (y0 > y1) {
+        std::swap(y0, y1);
+    }
+
+    ImagePNG copy_image(*this);
+    if (x0 == 0 && y0 == 0 && x1 == width_-1 && y1 == height_-1) {
+        return copy_image;
+    }
+
+    if (x0 < 0 || y0 < 0 || x1 >= width_ || y1 >= height_) {
+        copy_image.convertToRGBA();
+        ImagePNG area_image;
+        copy_image.copyArea(area_image, x0, y0, x1, y1);
+        return area_image;
+    }
+
+    copy_image.width_ = x1-x0+1;
+    copy_image.height_ = y1-y0+1;
+    copy_image.allocateNativeMemmory();
+    forNativeView(false, [&](auto src_view) {
+        decltype(src_view) dst_view(copy_image.buffer_.getData(), copy_image.width_,
+                                    copy_image.height_, copy_image.stride_);
+        dst_view.paste(src_view.subView(x0, y0, x1, y1), 0, 0);
+    });
+    return copy_image;
+}
+
+void ie::ImagePNG::copyFrom(ImageView<PixelRGBA> src_view)
+{
+    setPixelFormat(PNG_COLOR_TYPE_RGBA);
+    palette_.clear();
+    Image::copyFrom(src_view);
+}
+
+void ie::ImagePNG::paste(ImagePNG& src_image, int x0, int y0)
+{
+    if (src_image.color_type_ != color_type_ ||
+        (color_type_ == PNG_COLOR_TYPE_PALETTE && src_image.palette_ != palette_)) {
+        ImagePNG rgba_image(src_image);
+        rgba_image.convertToRGBA();
+        convertToRGBA();
+        Image::paste(rgba_image.Image::constView(), x0, y0);
+        return;
+    }
+
+    ImagePNG copy_image(src_image);
+    forNativeView(true, [&](auto dst_view) {
+        decltype(dst_view) src_view(copy_image.buffer_.getData(), copy_image.width_,
+                                    copy_image.height_, copy_image.stride_);
+        dst_view.paste(src_view, x0, y0);
+    });
+}
+
+void ie::ImagePNG::paste(ImageView<PixelRGBA> src_view, int x0, int y0)
+{
+    convertToRGBA();
+    Image::paste(src_view, x0, y0);
+}
+
+void ie::ImagePNG::rotate(int rotation_type)
+{
+    if (rotation_type == IMAGE_TURN_180) {
+        reflect(IMAGE_VERTICAL);
+        reflect(IMAGE_HORIZONTAL);
+        return;
+    }
+    if (rotation_type != IMAGE_TURN_90_CLOCKWISE && rotation_type != IMAGE_TURN_90_COUNTERCLOCKWISE) {
+        return;
+    }
+
+    ImagePNG copy_image(*this);
+    std::swap(width_, height_);
+    allocateNativeMemmory();
+
+    copy_image.forNativeView(false, [&](auto src_view) {
+        decltype(src_view) dst_view(buffer_.getData(), width_, height_, stride_);
+        for (int y = 0; y < height_; y++) {
+            for (int x = 0; x < width_; x++) {
+                if (rotation_type == IMAGE_TURN_90_CLOCKWISE) {
+                    dst_view.setAt(x, y, src_view.at(y, width_ - x - 1));
+                } else {
+                    dst_view.setAt(x, y, src_view.at(height_ - y - 1, x));
+                }
+            }
+        }
+    });
+}
+
+void ie::ImagePNG::reflect(int reflection_type)
+{
+    forNativeView(true, [&](auto view) { view.reflect(reflection_type); });
+}
+
+
+/*
+ * Process colors (palette images change the palette colors)
+ */
+
+void ie::ImagePNG::clear()
+{
+    if (color_type_ == PNG_COLOR_TYPE_GRAY_ALPHA || color_type_ == PNG_COLOR_TYPE_RGBA) {
+        Image::clear();
+        return;
+    }
+
+    setSize(width_, height_);
+}
+
+void ie::ImagePNG::colorReplace(Color old_color, Color new_color)
+{
+    if (color_type_ == PNG_COLOR_TYPE_PALETTE) {
+        for (ColorRGBA& color : palette_) {
+            if (color == old_color) {
+                color = new_color;
+            }
+        }
+        return;
+    }
+
+    Color native_old_color, native_new_color;
+    if (!toNativeColor(old_color, &native_old_color, false)) {
+        return;
+    }
+    if (!toNativeColor(new_color, &native_new_color, true)) {
+        convertToRGBA();
+        Image::colorReplace(old_color, new_color);
+        return;
+    }
+    forNativeView(true, [&](auto view) { view.colorReplace(native_old_color, native_new_color); });
+}
+
+void ie::ImagePNG::componentFilter(int component_idx, unsigned char component_value)
+{
+    if (color_type_ == PNG_COLOR_TYPE_PALETTE) {
+        for (ColorRGBA& color : palette_) {
+            if (component_idx == R_IDX) {
+                color.r = component_value;
+            } else if (component_idx == G_IDX) {
+                color.g = component_value;
+            } else if (component_idx == B_IDX) {
+                color.b = component_value;
+            }
+        }
+        return;
+    }
+
+    if (color_type_ == PNG_COLOR_TYPE_GRAY || color_type_ == PNG_COLOR_TYPE_GRAY_ALPHA) {
+        convertToRGBA();
+    }
+    forNativeView(true, [&](auto view) { view.componentFilter(component_idx, component_value); });
+}
+
+void ie::ImagePNG::inverseColors()
+{
+    if (color_type_ == PNG_COLOR_TYPE_PALETTE) {
+        for (ColorRGBA& color : palette_) {
+            color.inverse();
+        }
+        return;
+    }
+
+    forNativeView(true, [](auto view) { view.inverseColors(); });
+}
+
+void ie::ImagePNG::grayColors(int method)
+{
+    if (color_type_ == PNG_COLOR_TYPE_PALETTE) {
+        for (ColorRGBA& color : palette_) {
+            color.gray(method);
+        }
+        return;
+    }
+
+    forNativeView(true, [&](auto view) { view.grayColors(method); });
+}
+
+void ie::ImagePNG::floodFill(int x, int y, Color color)
+{
+    Color native_color;
+    if ((color_type_ == PNG_COLOR_TYPE_PALETTE && !isPaletteUnique()) ||
+        !toNativeColor(color, &native_color, true)) {
+        convertToRGBA();
+        Image::floodFill(x, y, color);
+        return;
+    }
+    forNativeView(true, [&](auto view) { view.floodFill(x, y, native_color); });
+}
+
+
+/*
+ * Drawing (lines, circles, polygons)
+ */
+
+void ie::ImagePNG::drawBresenhamLine(int x0, int y0, int x1, int y1, Color color)
+{
+    Color native_color;
+    if (!toNativeColor(color, &native_color, true)) {
+        convertToRGBA();
+        Image::drawBresenhamLine(x0, y0, x1, y1, color);
+        return;
+    }
+    forNativeView(true, [&](auto view) { view.drawBresenhamLine(x0, y0, x1, y1, native_color); });
+}
+
+void ie::ImagePNG::drawMurphyLine(int x0, int y0, int x1, int y1, int thickness, Color color)
+{
+    Color native_color;
+    if (!toNativeColor(color, &native_color, true)) {
+        convertToRGBA();
+        Image::drawMurphyLine(x0, y0, x1, y1, thickness, color);
+        return;
+    }
+    forNativeView(true, [&](auto view) {
+        view.drawMurphyLine(x0, y0, x1, y1, thickness, native_color);
+    });
+}
+
+void ie::ImagePNG::drawLine(int x0, int y0, int x1, int y1, int thickness, Color color)
+{
+    Color native_color;
+    if (!toNativeColor(color, &native_color, true)) {
+        convertToRGBA();
+        Image::drawLine(x0, y0, x1, y1, thickness, color);
+        return;
+    }
+    forNativeView(true, [&](auto view) { view.drawLine(x0, y0, x1, y1, thickness, native_color); });
+}
+
+void ie::ImagePNG::drawBresenhamCircle(int x0, int y0, int radius, Color color)
+{
+    Color native_color;
+    if (!toNativeColor(color, &native_color, true)) {
+        convertToRGBA();
+        Image::drawBresenhamCircle(x0, y0, radius, color);
+        return;
+    }
+    forNativeView(true, [&](auto view) { view.drawBresenhamCircle(x0, y0, radius, native_color); });
+}
+
+void ie::ImagePNG::drawCircle(int x0, int y0, int radius, int thickness,
+    Color color, bool fill, Color fill_color)
+{
+    Color native_color, native_fill_color = fill_color;
+    if (!toNativeColor(color, &native_color, true) ||
+        (fill && !toNativeColor(fill_color, &native_fill_color, true))) {
+        convertToRGBA();
+        Image::drawCircle(x0, y0, radius, thickness, color, fill, fill_color);
+        return;
+    }
+    forNativeView(true, [&](auto view) {
+        view.drawCircle(x0, y0, radius, thickness, native_color, fill, native_fill_color);
+    });
+}
+
+void ie::ImagePNG::drawPolygon(std::vector<Coord> vertices, int thickness,
+    Color color, bool fill, Color fill_color)
+{
+    Color native_color, native_fill_color = fill_color;
+    if (!toNativeColor(color, &native_color, true) ||
+        (fill && !toNativeColor(fill_color, &native_fill_color, true))) {
+        convertToRGBA();
+        Image::drawPolygon(vertices, thickness, color, fill, fill_color);
+        return;
+    }
+    forNativeView(true, [&](auto view) {
+        view.drawPolygon(vertices, thickness, native_color, fill, native_fill_color);
+    });
+}
+
+bool ie::ImagePNG::inPolygon(int x, int y, std::vector<Coord>& vertices)
+{
+    bool result = false;
+    forNativeView(false, [&](auto view) { result = view.inPolygon(x, y, vertices); });
+    return result;
+}
@@ -0,0 +1,216 @@
+/**
+ * @file PixelBuffer.cpp
+ * @brief Implementation of the PixelBuffer class (reference counting and copy-on-write)
+ * @version 0.1.0
+ * @date 2026-10-17
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+#include "PixelBuffer.h"
+#include "Error.h"
+#include <string.h>
+#include <utility>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define PIXEL_BUFFER_MMAP
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+
+ie::PixelBuffer::Block* ie::PixelBuffer::createBlock(size_t size)
+{
+    Block *block = new Block;
+    block->ref_count.store(1, std::memory_order_relaxed);
+    block->size = size;
+    block->data = (unsigned char*) BufferPool::getDefault().acquire(size, &block->capacity, &block->huge_pages);
+    block->map_base = NULL;
+    block->map_length = 0;
+    block->read_only = false;
+    block->pending.store(false, std::memory_order_relaxed);
+    if (!block->data) {
+        delete block;
+        throwError("Error: not enough memmory for image data.", BUFFER_ERROR);
+    }
+    return block;
+}
+
+ie::PixelBuffer::PixelBuffer() :
+    block_(NULL)
+{}
+
+ie::PixelBuffer::PixelBuffer(const PixelBuffer& other) :
+    block_(other.block_)
+{
+    if (block_) {
+        block_->ref_count.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+ie::PixelBuffer::PixelBuffer(PixelBuffer&& other) noexcept :
+    block_(other.block_)
+{
+    other.block_ = NULL;
+}
+
+ie::PixelBuffer::~PixelBuffer()
+{
+    release();
+}
+
+ie::PixelBuffer& ie::PixelBuffer::operator=(const PixelBuffer& other)
+{
+    PixelBuffer copy_buffer(other);
+    std::swap(block_, copy_buffer.block_);
+    return *this;
+}
+
+ie::PixelBuffer& ie::PixelBuffer::operator=(PixelBuffer&& other) noexcept
+{
+    if (this != &other) {
+        release();
+        std::swap(block_, other.block_);
+    }
+    return *this;
+}
+
+void ie::PixelBuffer::allocate(size_t size)
+{
+    release();
+    if (size > 0) {
+        block_ = createBlock(size);
+    }
+}
+
+bool ie::PixelBuffer::mapFile(const char *file_name, size_t offset, size_t size, bool writable)
+{
+    release();
+
+    #ifdef PIXEL_BUFFER_MMAP
+    int fd = open(file_name, O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+
+    struct stat file_stat;
+    if (fstat(fd, &file_stat) != 0 || size == 0 || (size_t)file_stat.st_size < offset + size) {
+        close(fd);
+        return false;
+    }
+
+    int protection = writable ? (PROT_READ | PROT_WRITE) : PROT_READ;
+    void *map_base = mmap(NULL, offset + size, protection, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (map_base == MAP_FAILED) {
+        return false;
+    }
+
+    block_ = new Block;
+    block_->ref_count.store(1, std::memory_order_relaxed);
+    block_->size = size;
+    block_->capacity = 0;
+    block_->huge_pages = false;
+    block_->data = (unsigned char*) map_base + offset;
+    block_->map_base = (unsigned char*) map_base;
+    block_->map_length = offset + size;
+    block_->read_only = !writable;
+    block_->pending.store(false, std::memory_order_relaxed);
+    return true;
+    #else
+    return false;
+    #endif
+}
+
+void ie::PixelBuffer::defer(size_t size, std::function<void(unsigned char *data, size_t size)> loader)
+{
+    release();
+    if (size == 0) {
+        return;
+    }
+
+    block_ = new Block;
+    block_->ref_count.store(1, std::memory_order_relaxed);
+    block_->size = size;
+    block_->capacity = 0;
+    block_->huge_pages = false;
+    block_->data = NULL;
+    block_->map_base = NULL;
+    block_->map_length = 0;
+    block_->read_only = false;
+    block_->loader = std::move(loader);
+    block_->pending.store(true, std::memory_order_release);
+}
+
+void ie::PixelBuffer::release()
+{
+    if (block_ && block_->ref_count.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        if (block_->map_base) {
+            #ifdef PIXEL_BUFFER_MMAP
+            munmap(block_->map_base, block_->map_length);
+            #endif
+        } else if (block_->data) {
+            BufferPool::getDefault().release(block_->data, block_->capacity, block_->huge_pages);
+        }
+        delete block_;
+    }
+    block_ = NULL;
+}
+
+bool ie::PixelBuffer::detach()
+{
+    if (!block_ || isWritable()) {
+        return false;
+    }
+
+    Block *block = createBlock(block_->size);
+    memcpy(block->data, getData(), block_->size);
+    release();
+    block_ = block;
+    return true;
+}
+
+bool ie::PixelBuffer::isWritable() const
+{
+    return block_ && !block_->read_only && block_->ref_count.load(std::memory_order_acquire) == 1;
+}
+
+bool ie::PixelBuffer::isShared() const
+{
+    return block_ && block_->ref_count.load(std::memory_order_acquire) > 1;
+}
+
+bool ie::PixelBuffer::isLoaded() const
+{
+    return block_ && !block_->pending.load(std::memory_order_acquire);
+}
+
+unsigned char* ie::PixelBuffer::getData() const
+{
+    if (!block_) {
+        return NULL;
+    }
+
+    /* the first owner to touch a deferred block loads it, the others wait for it */
+    if (block_->pending.load(std::memory_order_acquire)) {
+        Block *block = block_;
+        std::call_once(block->load_once, [block]() {
+            block->data = (unsigned char*) BufferPool::getDefault().acquire(block->size, &block->capacity, &block->huge_pages);
+            if (!block->data) {
+                throwError("Error: not enough memmory for image data.", BUFFER_ERROR);
+            }
+            block->loader(block->data, block->size);
+            block->loader = nullptr;
+            block->pending.store(false, std::memory_order_release);
+        });
+    }
+    return block_->data;
+}
+
+size_t ie::PixelBuffer::getSize() const
+{
+    return block_ ? block_->size : 0;
+}
@@ -0,0 +1,511 @@
+/**
+ * @file PixelKernels.cpp
+ * @brief Implementation of the row kernels and the choice of the instruction set
+ * @version 0.1.0
+ * @date 2026-10-17
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+#include "PixelKernels.h"
+#include <string.h>
+#include <stdint.h>
+#include <atomic>
+#if defined(__x86_64__) || defined(__i386__)
+#define PIXEL_KERNELS_X86
+#include <immintrin.h>
+#endif
+
+
+/**
+ * @brief Get the best instruction set of the processor
+ * 
+ * @return int - kernel level
+ */
+static int detectPixelKernelLevel()
+{
+#ifdef PIXEL_KERNELS_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")) {
+        return PIXEL_KERNEL_AVX512;
+    }
+    if (__builtin_cpu_supports("avx2")) {
+        return PIXEL_KERNEL_AVX2;
+    }
+    if (__builtin_cpu_supports("sse2")) {
+        return PIXEL_KERNEL_SSE2;
+    }
+#endif
+    return PIXEL_KERNEL_SCALAR;
+}
+
+/**
+ * @brief Get the instruction set of the processor (checked on the first call)
+ * 
+ * @return int - kernel level
+ */
+static int getSupportedLevel()
+{
+    static const int level = detectPixelKernelLevel();
+    return level;
+}
+
+#ifdef PIXEL_KERNELS_X86
+/**
+ * @brief Check whether the processor has AVX2 (checked on the first call)<br>
+ * (AVX-512F does not include it, so the AVX-512 level falls back to AVX2 kernels only with it)
+ * 
+ * @return true - if AVX2 kernels can run
+ */
+static bool isAVX2Supported()
+{
+    static const bool supported = (__builtin_cpu_init(), __builtin_cpu_supports("avx2") != 0);
+    return supported;
+}
+#endif
+
+/* -1 - not chosen yet, so the kernels work during static initialization of other files */
+static std::atomic<int> current_level(-1);
+
+/**
+ * @brief Get the instruction set used by the kernels
+ * 
+ * @return int - kernel level
+ */
+static int getCurrentLevel()
+{
+    int level = current_level.load(std::memory_order_relaxed);
+    if (level < 0) {
+        int supported = getSupportedLevel();
+        if (current_level.compare_exchange_strong(level, supported)) {
+            level = supported;
+        }
+    }
+    return level;
+}
+
+
+/*
+ * Row mask kernels (each processes whole groups of three vectors, the rest is left to the scalar one)
+ */
+
+static void applyRowMaskScalar(unsigned char *data, size_t begin, size_t length, const ie::RowMask& mask)
+{
+    for (size_t i = begin; i < length; i++) {
+        size_t j = i % PIXEL_KERNEL_PATTERN_SIZE;
+        data[i] = (data[i] & mask.and_bytes[j]) ^ mask.xor_bytes[j];
+    }
+}
+
+#ifdef PIXEL_KERNELS_X86
+
+__attribute__((target("sse2")))
+static size_t applyRowMaskSSE2(unsigned char *data, size_t length, const ie::RowMask& mask)
+{
+    __m128i and_vectors[3];
+    __m128i xor_vectors[3];
+    for (int k = 0; k < 3; k++) {
+        and_vectors[k] = _mm_loadu_si128((const __m128i*)(mask.and_bytes + 16*k));
+        xor_vectors[k] = _mm_loadu_si128((const __m128i*)(mask.xor_bytes + 16*k));
+    }
+
+    size_t i = 0;
+    for (; i + 48 <= length; i += 48) {
+        for (int k = 0; k < 3; k++) {
+            __m128i *vector = (__m128i*)(data + i + 16*k);
+            __m128i value = _mm_loadu_si128(vector);
+            value = _mm_xor_si128(_mm_and_si128(value, and_vectors[k]), xor_vectors[k]);
+            _mm_storeu_si128(vector, value);
+        }
+    }
+    return i;
+}
+
+__attribute__((target("avx2")))
+static size_t applyRowMaskAVX2(unsigned char *data, size_t length, const ie::RowMask& mask)
+{
+    __m256i and_vectors[3];
+    __m256i xor_vectors[3];
+    for (int k = 0; k < 3; k++) {
+        and_vectors[k] = _mm256_loadu_si256((const __m256i*)(mask.and_bytes + 32*k));
+        xor_vectors[k] = _mm256_loadu_si256((const __m256i*)(mask.xor_bytes + 32*k));
+    }
+
+    size_t i = 0;
+    for (; i + 96 <= length; i += 96) {
+        for (int k = 0; k < 3; k++) {
+            __m256i *vector = (__m256i*)(data + i + 32*k);
+            __m256i value = _mm256_loadu_si256(vector);
+            value = _mm256_xor_si256(_mm256_and_si256(value, and_vectors[k]), xor_vectors[k]);
+            _mm256_storeu_si256(vector, value);
+        }
+    }
+    return i;
+}
+
+__attribute__((target("avx512f")))
+static size_t applyRowMaskAVX512(unsigned char *data, size_t length, const ie::RowMask& mask)
+{
+    __m512i and_vectors[3];
+    __m512i xor_vectors[3];
+    for (int k = 0; k < 3; k++) {
+        and_vectors[k] = _mm512_loadu_si512(mask.and_bytes + 64*k);
+        xor_vectors[k] = _mm512_loadu_si512(mask.xor_bytes + 64*k);
+    }
+
+    size_t i = 0;
+    for (; i + 192 <= length; i += 192) {
+        for (int k = 0; k < 3; k++) {
+            unsigned char *vector = data + i + 64*k;
+            __m512i value = _mm512_loadu_si512(vector);
+            value = _mm512_xor_si512(_mm512_and_si512(value, and_vectors[k]), xor_vectors[k]);
+            _mm512_storeu_si512(vector, value);
+        }
+    }
+    return i;
+}
+
+#endif
+
+
+/*
+ * Gray kernels (the R, G and B components are bytes 0-2 of the pixel in any order, 
+ * weights[i] is the weight of byte i; the vector kernels take 3- or 4-byte pixels 
+ * and return the number of pixels done, the rest is left to the scalar one)
+ */
+
+/**
+ * @brief Structure for representing the arguments of the gray kernels
+ * 
+ */
+struct GrayRowArgs
+{
+    const unsigned char  *src;
+    unsigned char        *dst;          // the same as src - in place, otherwise one byte per pixel
+    size_t               count;
+    int                  pixel_size;
+    int                  offsets[3];    // offsets of R, G and B
+    int                  weights[3];    // weights of bytes 0-2
+    int                  method;
+    bool                 in_place;
+};
+
+static void grayRowScalar(const GrayRowArgs& args, size_t begin)
+{
+    const int r = args.offsets[0];
+    const int g = args.offsets[1];
+    const int b = args.offsets[2];
+
+    for (size_t i = begin; i < args.count; i++) {
+        const unsigned char *pixel = args.src + i*args.pixel_size;
+        unsigned char value = ie::grayValue(pixel[r], pixel[g], pixel[b], args.method);
+        if (args.in_place) {
+            unsigned char *dst_pixel = args.dst + i*args.pixel_size;
+            dst_pixel[r] = dst_pixel[g] = dst_pixel[b] = value;
+        } else {
+            args.dst[i] = value;
+        }
+    }
+}
+
+#ifdef PIXEL_KERNELS_X86
+
+__attribute__((target("sse2")))
+static inline __m128i multiplyLow32SSE2(__m128i a, __m128i b)
+{
+    __m128i even = _mm_mul_epu32(a, b);
+    __m128i odd = _mm_mul_epu32(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32));
+    return _mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)), 
+                              _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0)));
+}
+
+__attribute__((target("sse2")))
+static size_t grayRowSSE2(const GrayRowArgs& args)
+{
+    if (args.pixel_size != 4) {
+        return 0;
+    }
+
+    const __m128i byte_mask = _mm_set1_epi32(0xFF);
+    const __m128i alpha_mask = _mm_set1_epi32(0xFF000000);
+    const __m128i rounding = _mm_set1_epi32(1 << (GRAY_WEIGHT_BITS-1));
+    const __m128i one = _mm_set1_epi32(1);
+    const __m128i w0 = _mm_set1_epi32(args.weights[0]);
+    const __m128i w1 = _mm_set1_epi32(args.weights[1]);
+    const __m128i w2 = _mm_set1_epi32(args.weights[2]);
+    const bool lightness = (args.method == GRAY_LIGHTNESS);
+
+    size_t i = 0;
+    for (; i + 4 <= args.count; i += 4) {
+        __m128i v = _mm_loadu_si128((const __m128i*)(args.src + 4*i));
+        __m128i c0 = _mm_and_si128(v, byte_mask);
+        __m128i c1 = _mm_and_si128(_mm_srli_epi32(v, 8), byte_mask);
+        __m128i c2 = _mm_and_si128(_mm_srli_epi32(v, 16), byte_mask);
+
+        __m128i value;
+        if (lightness) {
+            __m128i max = _mm_max_epu8(c0, _mm_max_epu8(c1, c2));
+            __m128i min = _mm_min_epu8(c0, _mm_min_epu8(c1, c2));
+            value = _mm_srli_epi32(_mm_add_epi32(_mm_add_epi32(max, min), one), 1);
+        } else {
+            __m128i sum = _mm_add_epi32(multiplyLow32SSE2(c0, w0), multiplyLow32SSE2(c1, w1));
+            sum = _mm_add_epi32(sum, _mm_add_epi32(multiplyLow32SSE2(c2, w2), rounding));
+            value = _mm_srli_epi32(sum, GRAY_WEIGHT_BITS);
+        }
+
+        if (args.in_place) {
+            __m128i gray = _mm_or_si128(value, _mm_or_si128(_mm_slli_epi32(value, 8), _mm_slli_epi32(value, 16)));
+            _mm_storeu_si128((__m128i*)(args.dst + 4*i), _mm_or_si128(gray, _mm_and_si128(v, alpha_mask)));
+        } else {
+            __m128i packed = _mm_packus_epi16(_mm_packs_epi32(value, value), value);
+            int bytes = _mm_cvtsi128_si32(packed);
+            memcpy(args.dst + i, &bytes, 4);
+        }
+    }
+    return i;
+}
+
+__attribute__((target("avx2")))
+static size_t grayRowAVX2(const GrayRowArgs& args)
+{
+    if (args.pixel_size != 3 && args.pixel_size != 4) {
+        return 0;
+    }
+
+    const __m256i byte_mask = _mm256_set1_epi32(0xFF);
+    const __m256i alpha_mask = _mm256_set1_epi32(0xFF000000);
+    const __m256i rounding = _mm256_set1_epi32(1 << (GRAY_WEIGHT_BITS-1));
+    const __m256i one = _mm256_set1_epi32(1);
+    const __m256i w0 = _mm256_set1_epi32(args.weights[0]);
+    const __m256i w1 = _mm256_set1_epi32(args.weights[1]);
+    const __m256i w2 = _mm256_set1_epi32(args.weights[2]);
+    const bool lightness = (args.method == GRAY_LIGHTNESS);
+
+    /* 24-bit pixels: 4 pixels of each 128-bit half are spread to 32-bit lanes and back */
+    const __m256i expand = _mm256_setr_epi8(0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1, 
+                                            0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1);
+    const __m256i compress = _mm256_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1, 
+                                              0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1);
+    const __m256i first_bytes = _mm256_setr_epi8(0, 4, 8, 12, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 
+                                                 0, 4, 8, 12, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1);
+    const __m256i join_halves = _mm256_setr_epi32(0, 4, 0, 0, 0, 0, 0, 0);
+
+    /* the second half of 24-bit pixels is read with 16 bytes, 4 bytes after the 8 pixels */
+    const size_t extra = (args.pixel_size == 3) ? 2 : 0;
+
+    size_t i = 0;
+    for (; i + 8 + extra <= args.count; i += 8) {
+        const unsigned char *pixel = args.src + args.pixel_size*i;
+        __m256i v;
+        if (args.pixel_size == 4) {
+            v = _mm256_loadu_si256((const __m256i*)pixel);
+        } else {
+            __m128i low = _mm_loadu_si128((const __m128i*)pixel);
+            __m128i high = _mm_loadu_si128((const __m128i*)(pixel + 12));
+            v = _mm256_shuffle_epi8(_mm256_inserti128_si256(_mm256_castsi128_si256(low), high, 1), expand);
+        }
+        __m256i c0 = _mm256_and_si256(v, byte_mask);
+        __m256i c1 = _mm256_and_si256(_mm256_srli_epi32(v, 8), byte_mask);
+        __m256i c2 = _mm256_and_si256(_mm256_srli_epi32(v, 16), byte_mask);
+
+        __m256i value;
+        if (lightness) {
+            __m256i max = _mm256_max_epu8(c0, _mm256_max_epu8(c1, c2));
+            __m256i min = _mm256_min_epu8(c0, _mm256_min_epu8(c1, c2));
+            value = _mm256_srli_epi32(_mm256_add_epi32(_mm256_add_epi32(max, min), one), 1);
+        } else {
+            __m256i sum = _mm256_add_epi32(_mm256_mullo_epi32(c0, w0), _mm256_mullo_epi32(c1, w1));
+            sum = _mm256_add_epi32(sum, _mm256_add_epi32(_mm256_mullo_epi32(c2, w2), rounding));
+            value = _mm256_srli_epi32(sum, GRAY_WEIGHT_BITS);
+        }
+
+        if (!args.in_place) {
+            __m256i packed = _mm256_permutevar8x32_epi32(_mm256_shuffle_epi8(value, first_bytes), join_halves);
+            _mm_storel_epi64((__m128i*)(args.dst + i), _mm256_castsi256_si128(packed));
+            continue;
+        }
+
+        __m256i gray = _mm256_or_si256(value, _mm256_or_si256(_mm256_slli_epi32(value, 8), 
+                                                              _mm256_slli_epi32(value, 16)));
+        unsigned char *dst_pixel = args.dst + args.pixel_size*i;
+        if (args.pixel_size == 4) {
+            _mm256_storeu_si256((__m256i*)dst_pixel, _mm256_or_si256(gray, _mm256_and_si256(v, alpha_mask)));
+        } else {
+            /* 12 bytes of each half, the bytes after the 8 pixels are not written */
+            gray = _mm256_shuffle_epi8(gray, compress);
+            __m128i halves[2] = {_mm256_castsi256_si128(gray), _mm256_extracti128_si256(gray, 1)};
+            for (int k = 0; k < 2; k++) {
+                int last_bytes = _mm_cvtsi128_si32(_mm_srli_si128(halves[k], 8));
+                _mm_storel_epi64((__m128i*)(dst_pixel + 12*k), halves[k]);
+                memcpy(dst_pixel + 12*k + 8, &last_bytes, 4);
+            }
+        }
+    }
+    return i;
+}
+
+/* the AVX-512 intrinsics of GCC 12 start from an undefined vector that -Wmaybe-uninitialized reports */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+__attribute__((target("avx512f")))
+static size_t grayRowAVX512(const GrayRowArgs& args)
+{
+    if (args.pixel_size != 4) {
+        return 0;
+    }
+
+    const __m512i byte_mask = _mm512_set1_epi32(0xFF);
+    const __m512i alpha_mask = _mm512_set1_epi32(0xFF000000);
+    const __m512i rounding = _mm512_set1_epi32(1 << (GRAY_WEIGHT_BITS-1));
+    const __m512i one = _mm512_set1_epi32(1);
+    const __m512i w0 = _mm512_set1_epi32(args.weights[0]);
+    const __m512i w1 = _mm512_set1_epi32(args.weights[1]);
+    const __m512i w2 = _mm512_set1_epi32(args.weights[2]);
+    const bool lightness = (args.method == GRAY_LIGHTNESS);
+
+    size_t i = 0;
+    for (; i + 16 <= args.count; i += 16) {
+        __m512i v = _mm512_loadu_si512(args.src + 4*i);
+        __m512i c0 = _mm512_and_si512(v, byte_mask);
+        __m512i c1 = _mm512_and_si512(_mm512_srli_epi32(v, 8), byte_mask);
+        __m512i c2 = _mm512_and_si512(_mm512_srli_epi32(v, 16), byte_mask);
+
+        __m512i value;
+        if (lightness) {
+            __m512i max = _mm512_max_epu32(c0, _mm512_max_epu32(c1, c2));
+            __m512i min = _mm512_min_epu32(c0, _mm512_min_epu32(c1, c2));
+            value = _mm512_srli_epi32(_mm512_add_epi32(_mm512_add_epi32(max, min), one), 1);
+        } else {
+            __m512i sum = _mm512_add_epi32(_mm512_mullo_epi32(c0, w0), _mm512_mullo_epi32(c1, w1));
+            sum = _mm512_add_epi32(sum, _mm512_add_epi32(_mm512_mullo_epi32(c2, w2), rounding));
+            value = _mm512_srli_epi32(sum, GRAY_WEIGHT_BITS);
+        }
+
+        if (args.in_place) {
+            __m512i gray = _mm512_or_si512(value, _mm512_or_si512(_mm512_slli_epi32(value, 8), 
+                                                                  _mm512_slli_epi32(value, 16)));
+            _mm512_storeu_si512(args.dst + 4*i, _mm512_or_si512(gray, _mm512_and_si512(v, alpha_mask)));
+        } else {
+            _mm_storeu_si128((__m128i*)(args.dst + i), _mm512_cvtepi32_epi8(value));
+        }
+    }
+    return i;
+}
+#pragma GCC diagnostic pop
+
+#endif
+
+/**
+ * @brief Run the gray kernel of the current instruction set and finish the row with the scalar one
+ * 
+ * @param[in] args kernel arguments (weights are set here)
+ */
+static void grayRowDispatch(GrayRowArgs& args)
+{
+    if (args.method < GRAY_BT601 || args.method > GRAY_LIGHTNESS) {
+        args.method = GRAY_BT601;
+    }
+
+    /* the vector kernels need R, G and B in bytes 0-2 */
+    bool rgb_bytes = (args.pixel_size >= 3 && args.offsets[0] < 3 && args.offsets[1] < 3 && args.offsets[2] < 3 &&
+                      args.offsets[0] != args.offsets[1] && args.offsets[1] != args.offsets[2] && 
+                      args.offsets[0] != args.offsets[2]);
+    if (rgb_bytes && args.method != GRAY_LIGHTNESS) {
+        for (int k = 0; k < 3; k++) {
+            args.weights[args.offsets[k]] = ie::gray_weights[args.method][k];
+        }
+    }
+    size_t done = 0;
+
+#ifdef PIXEL_KERNELS_X86
+    if (rgb_bytes) {
+        switch (getCurrentLevel()) {
+            case PIXEL_KERNEL_AVX512:
+                if (args.pixel_size == 4) {
+                    done = grayRowAVX512(args);
+                } else if (isAVX2Supported()) {
+                    done = grayRowAVX2(args);
+                } else {
+                    done = grayRowSSE2(args);
+                }
+                break;
+            case PIXEL_KERNEL_AVX2:
+                done = grayRowAVX2(args);
+                break;
+            case PIXEL_KERNEL_SSE2:
+                done = grayRowSSE2(args);
+                break;
+        }
+    }
+#endif
+
+    grayRowScalar(args, done);
+}
+
+
+/*
+ * Public functions
+ */
+
+ie::RowMask::RowMask()
+{
+    memset(and_bytes, 0xFF, sizeof(and_bytes));
+    memset(xor_bytes, 0, sizeof(xor_bytes));
+}
+
+void ie::RowMask::setPixelByte(int pixel_size, int offset, unsigned char and_byte, unsigned char xor_byte)
+{
+    for (int i = offset; i < PIXEL_KERNEL_PATTERN_SIZE; i += pixel_size) {
+        and_bytes[i] = and_byte;
+        xor_bytes[i] = xor_byte;
+    }
+}
+
+void ie::applyRowMask(unsigned char *data, size_t length, const RowMask& mask)
+{
+    size_t done = 0;
+
+#ifdef PIXEL_KERNELS_X86
+    switch (getCurrentLevel()) {
+        case PIXEL_KERNEL_AVX512:
+            done = applyRowMaskAVX512(data, length, mask);
+            break;
+        case PIXEL_KERNEL_AVX2:
+            done = applyRowMaskAVX2(data, length, mask);
+            break;
+        case PIXEL_KERNEL_SSE2:
+            done = applyRowMaskSSE2(data, length, mask);
+            break;
+    }
+#endif
+
+    applyRowMaskScalar(data, done, length, mask);
+}
+
+void ie::grayRow(unsigned char *data, size_t count, int pixel_size, 
+                 int r_offset, int g_offset, int b_offset, int method)
+{
+    GrayRowArgs args = {data, data, count, pixel_size, {r_offset, g_offset, b_offset}, {0, 0, 0}, method, true};
+    grayRowDispatch(args);
+}
+
+void ie::grayRowToChannel(const unsigned char *src, unsigned char *dst, size_t count, int pixel_size, 
+                          int r_offset, int g_offset, int b_offset, int method)
+{
+    GrayRowArgs args = {src, dst, count, pixel_size, {r_offset, g_offset, b_offset}, {0, 0, 0}, method, false};
+    grayRowDispatch(args);
+}
+
+int ie::getPixelKernelLevel()
+{
+    return getCurrentLevel();
+}
+
+void ie::setPixelKernelLevel(int level)
+{
+    if (level < PIXEL_KERNEL_SCALAR) {
+        level = PIXEL_KERNEL_SCALAR;
+    }
+    current_level = (level < getSupportedLevel()) ? level : getSupportedLevel();
+}
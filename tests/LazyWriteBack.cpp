@@ -0,0 +1,97 @@
+/**
+ * @file LazyWriteBack.cpp
+ * @brief Test of writing a lazily read image back to the file it is read from
+ * @version 0.1.0
+ * @date 2026-10-17
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+#include "ImageEditor.h"
+#include <stdio.h>
+
+#define TEST_WIDTH                      123
+#define TEST_HEIGHT                     45
+
+static unsigned char testComponent(int x, int y, int c)
+{
+    return (unsigned char)((x*31 + y*17 + c*77 + x*y) & 255);
+}
+
+template <class ImageType>
+static bool sameImages(ImageType& first, ImageType& second)
+{
+    if (first.getWidth() != second.getWidth() || first.getHeight() != second.getHeight()) {
+        return false;
+    }
+    for (int y = 0; y < first.getHeight(); y++) {
+        for (int x = 0; x < first.getWidth(); x++) {
+            if (!(first.getColor(x, y) == second.getColor(x, y))) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+static bool testBMP(const char *file_name)
+{
+    ie::ImageBMP source;
+    source.setSize(TEST_WIDTH, TEST_HEIGHT);
+    for (int y = 0; y < TEST_HEIGHT; y++) {
+        for (int x = 0; x < TEST_WIDTH; x++) {
+            source.setColor(x, y, {testComponent(x, y, 0), testComponent(x, y, 1), testComponent(x, y, 2)});
+        }
+    }
+    source.writeImageToFile(file_name);
+
+    ie::ImageBMP lazy_image;
+    lazy_image.readImageFromFile(file_name, BMP_READ_LAZY);
+    lazy_image.writeImageToFile(file_name);
+
+    ie::ImageBMP result;
+    result.readImageFromFile(file_name);
+    return sameImages(source, result);
+}
+
+static bool testPNG(const char *file_name)
+{
+    ie::ImagePNG source;
+    source.setSize(TEST_WIDTH, TEST_HEIGHT);
+    for (int y = 0; y < TEST_HEIGHT; y++) {
+        for (int x = 0; x < TEST_WIDTH; x++) {
+            source.setColor(x, y, {testComponent(x, y, 0), testComponent(x, y, 1), 
+                                   testComponent(x, y, 2), testComponent(x, y, 3)});
+        }
+    }
+    source.writeImageToFile(file_name);
+
+    ie::ImagePNG lazy_image;
+    lazy_image.readImageFromFile(file_name, PNG_READ_LAZY);
+    lazy_image.writeImageToFile(file_name);
+
+    ie::ImagePNG result;
+    result.readImageFromFile(file_name);
+    return sameImages(source, result);
+}
+
+int main()
+{
+    int failed = 0;
+    if (!testBMP("lazy_write_back.bmp")) {
+        printf("FAILED: lazily read BMP written back to its own file\n");
+        failed++;
+    }
+    if (!testPNG("lazy_write_back.png")) {
+        printf("FAILED: lazily read PNG written back to its own file\n");
+        failed++;
+    }
+    remove("lazy_write_back.bmp");
+    remove("lazy_write_back.png");
+
+    if (failed == 0) {
+        printf("LazyWriteBack: OK\n");
+    }
+    return failed;
+}